@@ -1,4 +1,490 @@
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+
 #include "SegLibNumerical.h"
+#include "SegLibParallel.h"
+
+/*
+==================================================================================================================================================================================
+SIEVE
+
+    A segmented Sieve of Eratosthenes over a 2·3·5 wheel. Each byte covers 30 consecutive integers and holds one bit for each of the eight residues
+    coprime to 30, so multiples of 2, 3 and 5 take no space and are never crossed off. A set bit marks a composite.
+
+==================================================================================================================================================================================
+*/
+
+namespace {
+
+    constexpr uint32_t WheelResidues[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+
+    // Distance from each wheel residue to the next, wrapping 29 -> 31.
+    constexpr uint32_t WheelGaps[8] = {6, 4, 2, 4, 2, 4, 6, 2};
+
+    // Bit index of each residue modulo 30, or -1 when the residue shares a factor with 30.
+    constexpr int8_t ResidueBits[30] = {
+        -1,  0, -1, -1, -1, -1, -1,  1, -1, -1,
+        -1,  2, -1,  3, -1, -1, -1,  4, -1,  5,
+        -1, -1, -1,  6, -1, -1, -1, -1, -1,  7
+    };
+
+    // Bits of the wheel residues greater than or equal to each value in [0, 30].
+    constexpr std::array<uint8_t, 31> ResiduesFrom = [] {
+
+        std::array<uint8_t, 31> Masks{};
+
+        for (uint32_t Value = 0; Value <= 30; Value++) {
+            for (int i = 0; i < 8; i++) {
+                if (WheelResidues[i] >= Value) {
+                    Masks[Value] |= static_cast<uint8_t>(1u << i);
+                }
+            }
+        }
+
+        return Masks;
+
+    }();
+
+    // For a prime p = 30q + WheelResidues[r] and a factor on wheel residue i, stepping the factor to the next residue moves the multiple p * factor forward
+    // by q * WheelGaps[i] + StepCarry[r][i] bytes, and the multiple's bit within its byte is StepBits[r][i]. Crossing off then needs no division.
+    struct WheelStepTables {
+        uint8_t StepCarry[8][8];
+        uint8_t StepBits[8][8];
+    };
+
+    constexpr WheelStepTables StepTables = [] {
+
+        WheelStepTables Tables{};
+
+        for (int r = 0; r < 8; r++) {
+            for (int i = 0; i < 8; i++) {
+                uint32_t Residue = WheelResidues[r];
+                uint32_t Product = Residue * WheelResidues[i];
+                Tables.StepCarry[r][i] = static_cast<uint8_t>((Residue * (WheelResidues[i] + WheelGaps[i])) / 30 - Product / 30);
+                Tables.StepBits[r][i] = static_cast<uint8_t>(1u << ResidueBits[Product % 30]);
+            }
+        }
+
+        return Tables;
+
+    }();
+
+    // Segments are sized to stay resident in a typical 32KB L1 data cache.
+    constexpr size_t SegmentBytes = 32 * 1024;
+
+    /**
+     * @brief Plain odd-only sieve for the primes in [7, Limit], used to cross off the segments.
+     */
+    std::vector<uint32_t> SievingPrimes(uint64_t Limit) {
+
+        std::vector<uint32_t> Primes;
+        std::vector<bool> Composite(Limit / 2 + 1, false);
+
+        for (uint64_t Candidate = 3; Candidate <= Limit; Candidate += 2) {
+
+            if (Composite[Candidate / 2]) {
+                continue;
+            }
+
+            if (Candidate >= 7) {
+                Primes.push_back(static_cast<uint32_t>(Candidate));
+            }
+
+            for (uint64_t Multiple = Candidate * Candidate; Multiple <= Limit; Multiple += 2 * Candidate) {
+                Composite[Multiple / 2] = true;
+            }
+
+        }
+
+        return Primes;
+
+    }
+
+    /**
+     * @brief Crosses off the wheel bitmap bytes [ByteBegin, ByteEnd), which cover the integers [30 * ByteBegin, 30 * ByteEnd).
+     *
+     * @param Bytes Points at the byte for ByteBegin. The range is cleared first.
+     * @param Primes Every prime from 7 up to at least the square root of 30 * ByteEnd.
+     */
+    void SieveSegment(uint8_t* Bytes, uint64_t ByteBegin, uint64_t ByteEnd, const std::vector<uint32_t>& Primes) {
+
+        std::fill(Bytes, Bytes + (ByteEnd - ByteBegin), uint8_t(0));
+
+        uint64_t Low = ByteBegin * 30;
+        uint64_t High = ByteEnd * 30;
+
+        for (uint32_t Prime : Primes) {
+
+            uint64_t Square = uint64_t(Prime) * Prime;
+            if (Square >= High) {
+                break;
+            }
+
+            // Only multiples Prime * Factor with Factor coprime to 30 are on the wheel, and those with Factor < Prime were crossed off by a smaller prime.
+            uint64_t Factor = std::max<uint64_t>(Prime, (Low + Prime - 1) / Prime);
+            uint64_t Residue = Factor % 30;
+            Factor -= Residue;
+
+            size_t WheelIndex = 0;
+            while (WheelResidues[WheelIndex] < Residue) {
+                WheelIndex++;
+            }
+
+            Factor += WheelResidues[WheelIndex];
+
+            uint64_t Multiple = Factor * Prime;
+            if (Multiple >= High) {
+                continue;
+            }
+
+            uint64_t Quotient = Prime / 30;
+            const uint8_t* StepCarry = StepTables.StepCarry[ResidueBits[Prime % 30]];
+            const uint8_t* StepBits = StepTables.StepBits[ResidueBits[Prime % 30]];
+
+            uint64_t Position = Multiple / 30 - ByteBegin;
+            uint64_t Length = ByteEnd - ByteBegin;
+
+            while (Position < Length) {
+                Bytes[Position] |= StepBits[WheelIndex];
+                Position += Quotient * WheelGaps[WheelIndex] + StepCarry[WheelIndex];
+                WheelIndex = (WheelIndex + 1) & 7;
+            }
+
+        }
+
+        if (ByteBegin == 0) {
+            Bytes[0] |= 1;
+        }
+
+    }
+
+    /**
+     * @brief Sieves bytes [ByteBegin, ByteEnd) of a wheel bitmap in place, running segments in parallel on the shared thread pool.
+     *
+     * @param Bytes The whole bitmap, indexed from byte 0.
+     */
+    void SieveWheelRange(uint8_t* Bytes, uint64_t ByteBegin, uint64_t ByteEnd) {
+
+        if (ByteBegin >= ByteEnd) {
+            return;
+        }
+
+        std::vector<uint32_t> Primes = SievingPrimes(static_cast<uint64_t>(std::sqrt(double(ByteEnd * 30))) + 1);
+
+        size_t Segments = (ByteEnd - ByteBegin + SegmentBytes - 1) / SegmentBytes;
+
+        SLP::ParallelFor(Segments, [&](size_t Begin, size_t End) {
+            for (size_t Segment = Begin; Segment < End; Segment++) {
+                uint64_t SegmentBegin = ByteBegin + Segment * SegmentBytes;
+                uint64_t SegmentEnd = std::min<uint64_t>(SegmentBegin + SegmentBytes, ByteEnd);
+                SieveSegment(Bytes + SegmentBegin, SegmentBegin, SegmentEnd, Primes);
+            }
+        });
+
+    }
+
+    /**
+     * @brief Sieves the wheel bitmap for [0, 30 * ByteCount).
+     */
+    std::vector<uint8_t> SieveWheel(uint64_t ByteCount) {
+
+        std::vector<uint8_t> Bytes(ByteCount);
+        SieveWheelRange(Bytes.data(), 0, ByteCount);
+        return Bytes;
+
+    }
+
+    /**
+     * @brief An upper bound on the nth prime (1-based). Uses Dusart's n(ln n + ln ln n - 1 + (ln ln n - 2) / ln n) from n = 688383, otherwise
+     *        Rosser's n(ln n + ln ln n) for n >= 6.
+     */
+    uint64_t NthPrimeUpperBound(uint64_t Index) {
+
+        if (Index < 6) {
+            return 13;
+        }
+
+        double Count = static_cast<double>(Index);
+        double Log = std::log(Count);
+        double LogLog = std::log(Log);
+
+        if (Index < 688383) {
+            return static_cast<uint64_t>(Count * (Log + LogLog)) + 1;
+        }
+
+        // The margin covers rounding in the logarithms.
+        return static_cast<uint64_t>(Count * (Log + LogLog - 1 + (LogLog - 2) / Log)) + 64;
+
+    }
+
+    /**
+     * @brief A lower bound on the nth prime (1-based), Dusart's n(ln n + ln ln n - 1 + (ln ln n - 2.1) / ln n) for n >= 3.
+     */
+    uint64_t NthPrimeLowerBound(uint64_t Index) {
+
+        if (Index < 3) {
+            return Index == 0 ? 0 : Index + 1;
+        }
+
+        double Count = static_cast<double>(Index);
+        double Log = std::log(Count);
+        double LogLog = std::log(Log);
+        double Bound = Count * (Log + LogLog - 1 + (LogLog - 2.1) / Log);
+
+        return Bound > 64 ? static_cast<uint64_t>(Bound) - 64 : 2;
+
+    }
+
+    /**
+     * @brief Number of composites in the 30 integers covered by wheel byte Index, given the byte's bits.
+     */
+    size_t CompositesInByte(size_t Index, uint8_t Bits) {
+
+        // 22 of every 30 integers share a factor with 30. In the first byte 0, 2, 3 and 5 are not composite and 1 is flagged but not composite.
+        if (Index == 0) {
+            return std::popcount(Bits) - 1 + 18;
+        }
+
+        return std::popcount(Bits) + 22;
+
+    }
+
+    /**
+     * @brief Counts per segment with Counter, then fills Output in parallel from each segment's prefix offset, stopping at Output.size() entries.
+     *
+     * @return The total count across every segment, which may exceed Output.size().
+     */
+    template <typename SegmentCounter, typename SegmentWriter>
+    size_t CollectSegments(size_t ByteCount, std::vector<int>& Output, size_t Leading, SegmentCounter Counter, SegmentWriter Writer) {
+
+        size_t Segments = (ByteCount + SegmentBytes - 1) / SegmentBytes;
+        std::vector<size_t> Offsets(Segments + 1, 0);
+
+        SLP::ParallelFor(Segments, [&](size_t Begin, size_t End) {
+            for (size_t Segment = Begin; Segment < End; Segment++) {
+                Offsets[Segment + 1] = Counter(Segment * SegmentBytes, std::min<size_t>((Segment + 1) * SegmentBytes, ByteCount));
+            }
+        });
+
+        Offsets[0] = Leading;
+        for (size_t Segment = 0; Segment < Segments; Segment++) {
+            Offsets[Segment + 1] += Offsets[Segment];
+        }
+
+        if (Offsets[Segments] < Output.size()) {
+            return Offsets[Segments];
+        }
+
+        SLP::ParallelFor(Segments, [&](size_t Begin, size_t End) {
+            for (size_t Segment = Begin; Segment < End; Segment++) {
+                if (Offsets[Segment] < Output.size()) {
+                    Writer(Segment * SegmentBytes, std::min<size_t>((Segment + 1) * SegmentBytes, ByteCount), Offsets[Segment]);
+                }
+            }
+        });
+
+        return Offsets[Segments];
+
+    }
+
+
+    // ThreadRng state. Bumping RngGeneration makes each thread reseed from SharedRngSeed on its next call.
+    std::atomic<uint64_t> SharedRngSeed{0};
+    std::atomic<uint64_t> RngGeneration{0};
+    std::atomic<uint64_t> NextRngStream{0};
+
+    // PrimePi answers from the PrimeCache below this, growing it if needed, and NthPrime does the same for indices up to NthPrimeSieveLimit.
+    constexpr uint64_t PrimePiSieveLimit = uint64_t(1) << 24;
+    constexpr uint64_t NthPrimeSieveLimit = 1000000;
+
+    /**
+     * @brief The largest Root with Root^Degree <= Value.
+     */
+    uint64_t IntegerRoot(uint64_t Value, int Degree) {
+
+        auto Exceeds = [&](uint64_t Root) {
+            uint64_t Power = 1;
+            for (int i = 0; i < Degree; i++) {
+                if (Power > Value / Root) {
+                    return true;
+                }
+                Power *= Root;
+            }
+            return false;
+        };
+
+        uint64_t Root = static_cast<uint64_t>(std::pow(static_cast<double>(Value), 1.0 / Degree));
+
+        while (Root > 1 && Exceeds(Root)) {
+            Root--;
+        }
+
+        while (!Exceeds(Root + 1)) {
+            Root++;
+        }
+
+        return Root;
+
+    }
+
+    /**
+     * @brief Closed forms of phi(x, a), the count of integers in [1, x] with no prime factor among the first a primes, for a <= 6.
+     *
+     * @note The pattern of such integers repeats every 2·3·5·7·11·13 = 30030, so phi(x, a) is a whole number of periods plus a table lookup.
+     */
+    struct PhiTables {
+
+        static constexpr size_t Depth = 6;
+
+        uint64_t Products[Depth + 1];
+        uint64_t Totients[Depth + 1];
+        std::vector<uint16_t> Counts[Depth + 1];
+
+        PhiTables() {
+
+            constexpr uint64_t Primes[Depth] = {2, 3, 5, 7, 11, 13};
+
+            Products[0] = 1;
+            Totients[0] = 1;
+
+            for (size_t a = 1; a <= Depth; a++) {
+
+                Products[a] = Products[a - 1] * Primes[a - 1];
+                Totients[a] = Totients[a - 1] * (Primes[a - 1] - 1);
+
+                Counts[a].resize(Products[a]);
+
+                uint16_t Count = 0;
+                for (uint64_t r = 0; r < Products[a]; r++) {
+
+                    bool Coprime = r > 0;
+                    for (size_t i = 0; i < a && Coprime; i++) {
+                        Coprime = r % Primes[i] != 0;
+                    }
+
+                    Count += Coprime;
+                    Counts[a][r] = Count;
+
+                }
+
+            }
+
+        }
+
+        uint64_t Phi(uint64_t Value, size_t a) const {
+            return Value / Products[a] * Totients[a] + Counts[a][Value % Products[a]];
+        }
+
+    };
+
+    /**
+     * @brief Counts primes with Lehmer's formula, answering small counts from the shared PrimeCache.
+     *
+     * @note pi(x) = phi(x, a) + (b + a - 2)(b - a + 1) / 2 - sum over a < i <= b of pi(x / p_i)
+     *                - sum over a < i <= c, i <= j <= b_i of (pi(x / (p_i p_j)) - (j - 1)),
+     *       with a = pi(x^(1/4)), b = pi(x^(1/2)), c = pi(x^(1/3)) and b_i = pi((x / p_i)^(1/2)).
+     *       The cache is grown to 4x^(2/3), which measured fastest, and larger pi(x / p_i) recurse into the formula.
+     */
+    class LehmerCounter {
+
+        private:
+
+        SLN::PrimeCache& Cache;
+        uint64_t SieveLimit;
+        std::vector<uint64_t> Primes;
+
+        static const PhiTables& Tables() {
+            static const PhiTables Shared;
+            return Shared;
+        }
+
+        int64_t Phi(uint64_t Value, size_t a) {
+
+            if (a <= PhiTables::Depth) {
+                return static_cast<int64_t>(Tables().Phi(Value, a));
+            }
+
+            if (Value <= Primes[a - 1]) {
+                return Value >= 1;
+            }
+
+            // Below the square of the next prime, the survivors are 1 and the primes above p_a.
+            if (Value < Primes[a] * Primes[a]) {
+                return static_cast<int64_t>(Pi(Value)) - static_cast<int64_t>(a) + 1;
+            }
+
+            return Phi(Value, a - 1) - Phi(Value / Primes[a - 1], a - 1);
+
+        }
+
+        public:
+
+        explicit LehmerCounter(uint64_t Maximum) : Cache(SLN::GetPrimeCache()) {
+
+            uint64_t CubeRoot = IntegerRoot(Maximum, 3);
+            SieveLimit = std::clamp<uint64_t>(4 * CubeRoot * CubeRoot, uint64_t(1) << 20, uint64_t(1) << 32);
+
+            Cache.Reserve(SieveLimit);
+            Primes = Cache.PrimesUpTo(IntegerRoot(Maximum, 2) + 1);
+
+        }
+
+        uint64_t Pi(uint64_t Value) {
+
+            if (Value < SieveLimit) {
+                return Cache.CountPrimesUpTo(Value);
+            }
+
+            uint64_t a = Pi(IntegerRoot(Value, 4));
+            uint64_t b = Pi(IntegerRoot(Value, 2));
+            uint64_t c = Pi(IntegerRoot(Value, 3));
+
+            int64_t Sum = Phi(Value, a) + static_cast<int64_t>((b + a - 2) * (b - a + 1) / 2);
+
+            for (uint64_t i = a + 1; i <= b; i++) {
+
+                uint64_t Quotient = Value / Primes[i - 1];
+                Sum -= static_cast<int64_t>(Pi(Quotient));
+
+                if (i <= c) {
+
+                    uint64_t Bi = Pi(IntegerRoot(Quotient, 2));
+                    for (uint64_t j = i; j <= Bi; j++) {
+                        Sum -= static_cast<int64_t>(Pi(Quotient / Primes[j - 1])) - static_cast<int64_t>(j - 1);
+                    }
+
+                }
+
+            }
+
+            return static_cast<uint64_t>(Sum);
+
+        }
+
+    };
+
+    /**
+     * @brief The Index-th composite (1-based), the smallest x with x - pi(x) - 1 >= Index.
+     *
+     * @note Iterates x = Index + 1 + pi(x) upwards from Index + 1. Every iterate is at most the answer, and the first fixed point is the answer.
+     */
+    uint64_t NthComposite(uint64_t Index) {
+
+        uint64_t Value = Index + 1;
+
+        while (true) {
+            uint64_t Next = Index + 1 + SLN::PrimePi(Value);
+            if (Next == Value) {
+                return Value;
+            }
+            Value = Next;
+        }
+
+    }
+
+}
 
 /*
 ==================================================================================================================================================================================
@@ -11,45 +497,821 @@ GENERATIVE FUNCTIONS
 
 namespace SLN {
 
+    Rng& ThreadRng() {
+
+        thread_local uint64_t Stream = NextRngStream.fetch_add(1, std::memory_order_relaxed);
+        thread_local uint64_t Generation = UINT64_MAX;
+        thread_local Rng Generator;
+
+        uint64_t Current = RngGeneration.load(std::memory_order_acquire);
+
+        if (Generation != Current) {
+            Generator.Seed(SharedRngSeed.load(std::memory_order_relaxed), Stream);
+            Generation = Current;
+        }
+
+        return Generator;
+
+    }
+
+    void SeedRng(uint64_t Seed) {
+
+        SharedRngSeed.store(Seed, std::memory_order_relaxed);
+        RngGeneration.fetch_add(1, std::memory_order_release);
+
+    }
+
     float RandFloatInRange(float Minimum, float Maximum) {
 
-    float Rand = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
-    return Minimum + (Rand * (Maximum - Minimum));
+        return ThreadRng().UniformFloat(Minimum, Maximum);
+
+    }
+
+    void FillUniform(std::span<float> Values, float Minimum, float Maximum, Rng& Generator) {
+
+        constexpr size_t Lanes = RngLanes::Lanes;
+
+        RngLanes Streams(Generator);
+        uint64_t Block[Lanes];
+        float Buffer[2 * Lanes];
+
+        float Scale = Maximum - Minimum;
+
+        for (size_t i = 0; i < Values.size(); i += 2 * Lanes) {
+
+            Streams.Next(Block);
+
+            // Bits 41-63 and 9-31 of each output become the mantissas of two floats in [1, 2).
+            for (size_t Lane = 0; Lane < Lanes; Lane++) {
+                uint32_t High = static_cast<uint32_t>(Block[Lane] >> 41);
+                uint32_t Low = static_cast<uint32_t>(Block[Lane] >> 9) & 0x7FFFFF;
+                Buffer[Lane] = Minimum + (std::bit_cast<float>(0x3F800000u | High) - 1.0f) * Scale;
+                Buffer[Lanes + Lane] = Minimum + (std::bit_cast<float>(0x3F800000u | Low) - 1.0f) * Scale;
+            }
+
+            std::copy_n(Buffer, std::min(2 * Lanes, Values.size() - i), Values.begin() + i);
+
+        }
+
+    }
+
+    void FillUniform(std::span<bool> Values, Rng& Generator) {
+
+        constexpr size_t Lanes = RngLanes::Lanes;
+
+        RngLanes Streams(Generator);
+        uint64_t Block[Lanes];
+        bool Buffer[64 * Lanes];
+
+        for (size_t i = 0; i < Values.size(); i += 64 * Lanes) {
+
+            Streams.Next(Block);
+
+            for (size_t Bit = 0; Bit < 64; Bit++) {
+                for (size_t Lane = 0; Lane < Lanes; Lane++) {
+                    Buffer[Bit * Lanes + Lane] = (Block[Lane] >> Bit) & 1;
+                }
+            }
+
+            std::copy_n(Buffer, std::min(64 * Lanes, Values.size() - i), Values.begin() + i);
+
+        }
 
     }
 
     std::vector<int> GeneratePrimes(size_t Limit) {
 
-        std::vector<int> Primes;
-        Primes.reserve(Limit);
+        std::vector<int> Primes(Limit);
 
-        size_t Index = 5;
+        constexpr int WheelPrimes[3] = {2, 3, 5};
+        for (size_t i = 0; i < std::min<size_t>(Limit, 3); i++) {
+            Primes[i] = WheelPrimes[i];
+        }
 
-        while (Primes.size() != Limit) {
-            if (IsPrime(Index)) Primes.emplace_back(Index);
-            Index++;
+        if (Limit <= 3) {
+            return Primes;
         }
 
+        // Sieve exactly up to the last prime wanted.
+        uint64_t ByteCount = NthPrime(Limit) / 30 + 1;
+        std::vector<uint8_t> Bytes = SieveWheel(ByteCount);
+
+        auto Counter = [&](size_t ByteBegin, size_t ByteEnd) {
+            size_t Count = 0;
+            for (size_t i = ByteBegin; i < ByteEnd; i++) {
+                Count += 8 - std::popcount(Bytes[i]);
+            }
+            return Count;
+        };
+
+        auto Writer = [&](size_t ByteBegin, size_t ByteEnd, size_t Offset) {
+            for (size_t i = ByteBegin; i < ByteEnd && Offset < Primes.size(); i++) {
+                unsigned int Unmarked = static_cast<uint8_t>(~Bytes[i]);
+                while (Unmarked && Offset < Primes.size()) {
+                    Primes[Offset++] = static_cast<int>(30 * i + WheelResidues[std::countr_zero(Unmarked)]);
+                    Unmarked &= Unmarked - 1;
+                }
+            }
+        };
+
+        CollectSegments(ByteCount, Primes, 3, Counter, Writer);
         return Primes;
 
     }
 
     std::vector<int> GenerateComposites(size_t Limit) {
 
-        std::vector<int> Composites;
-        Composites.reserve(Limit);
-
-        size_t Index = 0;
+        std::vector<int> Composites(Limit);
 
-        while (Composites.size() != Limit) {
-            if (IsComposite(Index)) Composites.emplace_back(Index);
-            Index++;
+        if (Limit == 0) {
+            return Composites;
         }
 
+        uint64_t ByteCount = NthComposite(Limit) / 30 + 1;
+        std::vector<uint8_t> Bytes = SieveWheel(ByteCount);
+
+        auto Counter = [&](size_t ByteBegin, size_t ByteEnd) {
+            size_t Count = 0;
+            for (size_t i = ByteBegin; i < ByteEnd; i++) {
+                Count += CompositesInByte(i, Bytes[i]);
+            }
+            return Count;
+        };
+
+        auto Writer = [&](size_t ByteBegin, size_t ByteEnd, size_t Offset) {
+            for (size_t i = ByteBegin; i < ByteEnd && Offset < Composites.size(); i++) {
+                for (uint32_t Residue = 0; Residue < 30 && Offset < Composites.size(); Residue++) {
+
+                    uint64_t Value = 30 * i + Residue;
+                    int Bit = ResidueBits[Residue];
+
+                    bool Composite = Bit < 0 ? Value >= 4 && Value != 5 : Value != 1 && ((Bytes[i] >> Bit) & 1);
+
+                    if (Composite) {
+                        Composites[Offset++] = static_cast<int>(Value);
+                    }
+
+                }
+            }
+        };
+
+        CollectSegments(ByteCount, Composites, 0, Counter, Writer);
         return Composites;
 
     }
 
+/*
+==================================================================================================================================================================================
+PRIME CACHE
+
+==================================================================================================================================================================================
+*/
+
+    bool PrimeCache::SieveIsPrime(const Sieve& Current, uint64_t Value) {
+
+        if (Value < 30) {
+            return SmallPrimeTable.IsPrime(Value);
+        }
+
+        int Bit = ResidueBits[Value % 30];
+        return Bit >= 0 && !((Current.Bytes[Value / 30] >> Bit) & 1);
+
+    }
+
+    uint64_t PrimeCache::SieveCount(const Sieve& Current, uint64_t Maximum) {
+
+        if (Maximum < 7) {
+            return (Maximum >= 2) + (Maximum >= 3) + (Maximum >= 5);
+        }
+
+        uint64_t Byte = Maximum / 30;
+        uint64_t Block = Byte / BlockBytes;
+
+        uint64_t Count = 3 + Current.BlockCounts[Block];
+
+        for (uint64_t i = Block * BlockBytes; i < Byte; i++) {
+            Count += 8 - std::popcount(Current.Bytes[i]);
+        }
+
+        unsigned int Unmarked = static_cast<uint8_t>(~Current.Bytes[Byte]);
+        while (Unmarked && 30 * Byte + WheelResidues[std::countr_zero(Unmarked)] <= Maximum) {
+            Count++;
+            Unmarked &= Unmarked - 1;
+        }
+
+        return Count;
+
+    }
+
+    const PrimeCache::Sieve& PrimeCache::Acquire(uint64_t Maximum) {
+
+        const Sieve* Current = Published.load(std::memory_order_acquire);
+
+        if (Maximum < Current->Limit) {
+            return *Current;
+        }
+
+        std::lock_guard<std::mutex> Guard(GrowthLock);
+
+        Current = Published.load(std::memory_order_acquire);
+        if (Maximum < Current->Limit) {
+            return *Current;
+        }
+
+        // Grow at least geometrically so a run of slightly larger requests costs amortised linear time, and whole blocks keep BlockCounts exact.
+        uint64_t ByteCount = std::max(Maximum / 30 + 1, 2 * (Current->Limit / 30));
+        ByteCount = (ByteCount + BlockBytes - 1) / BlockBytes * BlockBytes;
+
+        std::unique_ptr<Sieve> Grown = std::make_unique<Sieve>();
+        Grown->Limit = ByteCount * 30;
+        Grown->Bytes.resize(ByteCount);
+        std::copy(Current->Bytes.begin(), Current->Bytes.end(), Grown->Bytes.begin());
+
+        SieveWheelRange(Grown->Bytes.data(), Current->Bytes.size(), ByteCount);
+
+        size_t Blocks = ByteCount / BlockBytes;
+        Grown->BlockCounts.resize(Blocks + 1);
+        std::copy(Current->BlockCounts.begin(), Current->BlockCounts.end(), Grown->BlockCounts.begin());
+
+        for (size_t Block = Current->Bytes.size() / BlockBytes; Block < Blocks; Block++) {
+
+            uint64_t Count = 0;
+            for (size_t i = Block * BlockBytes; i < (Block + 1) * BlockBytes; i++) {
+                Count += 8 - std::popcount(Grown->Bytes[i]);
+            }
+
+            Grown->BlockCounts[Block + 1] = Grown->BlockCounts[Block] + Count;
+
+        }
+
+        // Earlier sieves are kept alive, as readers may still hold them.
+        const Sieve* Result = Grown.get();
+        Generations.push_back(std::move(Grown));
+        Published.store(Result, std::memory_order_release);
+
+        return *Result;
+
+    }
+
+    PrimeCache::PrimeCache() {
+
+        std::unique_ptr<Sieve> Empty = std::make_unique<Sieve>();
+        Empty->BlockCounts.push_back(0);
+
+        Published.store(Empty.get(), std::memory_order_release);
+        Generations.push_back(std::move(Empty));
+
+    }
+
+    void PrimeCache::Reserve(uint64_t Maximum) {
+        Acquire(Maximum);
+    }
+
+    uint64_t PrimeCache::Bound() const {
+        return Published.load(std::memory_order_acquire)->Limit;
+    }
+
+    bool PrimeCache::IsPrime(uint64_t Value) const {
+
+        const Sieve* Current = Published.load(std::memory_order_acquire);
+
+        if (Value < Current->Limit) {
+            return SieveIsPrime(*Current, Value);
+        }
+
+        return SLN::IsPrime(Value);
+
+    }
+
+    bool PrimeCache::IsComposite(uint64_t Value) const {
+        return Value > 1 && !IsPrime(Value);
+    }
+
+    uint64_t PrimeCache::CountPrimesUpTo(uint64_t Maximum) {
+        return SieveCount(Acquire(Maximum), Maximum);
+    }
+
+    uint64_t PrimeCache::NthPrime(uint64_t Index) {
+
+        if (Index == 0) {
+            return 0;
+        }
+
+        constexpr uint64_t WheelPrimes[3] = {2, 3, 5};
+        if (Index <= 3) {
+            return WheelPrimes[Index - 1];
+        }
+
+        const Sieve& Current = Acquire(NthPrimeUpperBound(Index));
+
+        // BlockCounts excludes 2, 3 and 5. Find the last block boundary with fewer than the wanted primes before it, then scan its bytes.
+        uint64_t Wanted = Index - 3;
+        size_t Block = std::lower_bound(Current.BlockCounts.begin(), Current.BlockCounts.end(), Wanted) - Current.BlockCounts.begin() - 1;
+        uint64_t Seen = Current.BlockCounts[Block];
+
+        for (size_t i = Block * BlockBytes; ; i++) {
+
+            unsigned int Unmarked = static_cast<uint8_t>(~Current.Bytes[i]);
+            uint64_t InByte = std::popcount(Unmarked);
+
+            if (Seen + InByte < Wanted) {
+                Seen += InByte;
+                continue;
+            }
+
+            while (++Seen < Wanted) {
+                Unmarked &= Unmarked - 1;
+            }
+
+            return 30 * i + WheelResidues[std::countr_zero(Unmarked)];
+
+        }
+
+    }
+
+    std::vector<uint64_t> PrimeCache::PrimesUpTo(uint64_t Maximum) {
+
+        const Sieve& Current = Acquire(Maximum);
+
+        std::vector<uint64_t> Primes;
+        Primes.reserve(SieveCount(Current, Maximum));
+
+        for (uint64_t Prime : {2, 3, 5}) {
+            if (Prime <= Maximum) {
+                Primes.push_back(Prime);
+            }
+        }
+
+        for (uint64_t i = 0; 30 * i <= Maximum; i++) {
+
+            unsigned int Unmarked = static_cast<uint8_t>(~Current.Bytes[i]);
+
+            while (Unmarked) {
+
+                uint64_t Prime = 30 * i + WheelResidues[std::countr_zero(Unmarked)];
+                if (Prime > Maximum) {
+                    break;
+                }
+
+                Primes.push_back(Prime);
+                Unmarked &= Unmarked - 1;
+
+            }
+
+        }
+
+        return Primes;
+
+    }
+
+    PrimeCache& GetPrimeCache() {
+
+        static PrimeCache Cache;
+        return Cache;
+
+    }
+
+/*
+==================================================================================================================================================================================
+PRIME COUNTING
+
+==================================================================================================================================================================================
+*/
+
+    uint64_t PrimePi(uint64_t Maximum) {
+
+        PrimeCache& Cache = GetPrimeCache();
+
+        if (Maximum < std::max<uint64_t>(Cache.Bound(), PrimePiSieveLimit)) {
+            return Cache.CountPrimesUpTo(Maximum);
+        }
+
+        return LehmerCounter(Maximum).Pi(Maximum);
+
+    }
+
+    uint64_t NthPrime(uint64_t Index) {
+
+        if (Index <= NthPrimeSieveLimit) {
+            return GetPrimeCache().NthPrime(Index);
+        }
+
+        // Count the primes below a whole wheel byte under the lower bound, then sieve forward one segment at a time. The gap to the upper bound is
+        // a fraction of a percent of the answer, so this is usually a single segment.
+        uint64_t ByteBegin = NthPrimeLowerBound(Index) / 30;
+        uint64_t Seen = PrimePi(30 * ByteBegin - 1);
+
+        std::vector<uint32_t> Primes = SievingPrimes(IntegerRoot(NthPrimeUpperBound(Index) + 30 * SegmentBytes, 2) + 1);
+        std::vector<uint8_t> Bytes(SegmentBytes);
+
+        while (true) {
+
+            SieveSegment(Bytes.data(), ByteBegin, ByteBegin + SegmentBytes, Primes);
+
+            for (size_t i = 0; i < SegmentBytes; i++) {
+
+                unsigned int Unmarked = static_cast<uint8_t>(~Bytes[i]);
+                uint64_t InByte = std::popcount(Unmarked);
+
+                if (Seen + InByte < Index) {
+                    Seen += InByte;
+                    continue;
+                }
+
+                while (++Seen < Index) {
+                    Unmarked &= Unmarked - 1;
+                }
+
+                return 30 * (ByteBegin + i) + WheelResidues[std::countr_zero(Unmarked)];
+
+            }
+
+            ByteBegin += SegmentBytes;
+
+        }
+
+    }
+
+
+/*
+==================================================================================================================================================================================
+PRIME STREAMS
+
+==================================================================================================================================================================================
+*/
+
+    SieveWindow::SieveWindow(uint64_t From) : Position(From) {}
+
+    void SieveWindow::Slide(uint64_t Begin) {
+
+        constexpr size_t FirstBytes = 64;
+
+        ByteBegin = Begin;
+
+        if (ByteBegin + FirstBytes > StreamSieveLimit / 30) {
+
+            Bytes.assign(FirstBytes, 0);
+
+            for (size_t i = 0; i < FirstBytes; i++) {
+                for (int Bit = 0; Bit < 8; Bit++) {
+                    if (!IsPrime<uint64_t>(30 * (ByteBegin + i) + WheelResidues[Bit])) {
+                        Bytes[i] |= static_cast<uint8_t>(1u << Bit);
+                    }
+                }
+            }
+
+            return;
+
+        }
+
+        Bytes.resize(Bytes.empty() ? FirstBytes : std::min(2 * Bytes.size(), SegmentBytes));
+
+        uint64_t ByteEnd = ByteBegin + Bytes.size();
+        uint64_t Needed = IntegerRoot(30 * ByteEnd, 2) + 1;
+
+        if (Needed > PrimesLimit) {
+            PrimesLimit = std::max(Needed, 2 * PrimesLimit);
+            Primes = SievingPrimes(PrimesLimit);
+        }
+
+        SieveSegment(Bytes.data(), ByteBegin, ByteEnd, Primes);
+
+    }
+
+    uint64_t SieveWindow::NextPrime() {
+
+        for (uint64_t Prime : {2, 3, 5}) {
+            if (Position <= Prime) {
+                Position = Prime + 1;
+                return Prime;
+            }
+        }
+
+        while (true) {
+
+            uint64_t Byte = Position / 30;
+
+            if (Byte < ByteBegin || Byte >= ByteBegin + Bytes.size()) {
+                Slide(Byte);
+            }
+
+            unsigned int Unmarked = static_cast<uint8_t>(~Bytes[Byte - ByteBegin]) & ResiduesFrom[Position % 30];
+
+            if (Unmarked) {
+                uint64_t Prime = 30 * Byte + WheelResidues[std::countr_zero(Unmarked)];
+                Position = Prime + 1;
+                return Prime;
+            }
+
+            Position = 30 * (Byte + 1);
+
+        }
+
+    }
+
+    uint64_t SieveWindow::NextComposite() {
+
+        while (true) {
+
+            uint64_t Value = Position++;
+            uint64_t Byte = Value / 30;
+            int Bit = ResidueBits[Value % 30];
+
+            if (Bit < 0) {
+                if (Value >= 4 && Value != 5) {
+                    return Value;
+                }
+                continue;
+            }
+
+            if (Byte < ByteBegin || Byte >= ByteBegin + Bytes.size()) {
+                Slide(Byte);
+            }
+
+            if (Value != 1 && ((Bytes[Byte - ByteBegin] >> Bit) & 1)) {
+                return Value;
+            }
+
+        }
+
+    }
+
+}
+
+/*
+==================================================================================================================================================================================
+FACTORIZATION
+
+==================================================================================================================================================================================
+*/
+
+namespace {
+
+    constexpr uint64_t SmallestFactorLimit = uint64_t(1) << 20;
+
+    /**
+     * @brief The smallest prime factor of every composite below SmallestFactorLimit, and 0 for everything else. Built once by a linear sieve.
+     *
+     * @note A composite below 2^20 has a factor below 2^10, so 16 bits per entry suffice.
+     */
+    const std::vector<uint16_t>& SmallestFactors() {
+
+        static const std::vector<uint16_t> Table = [] {
+
+            std::vector<uint16_t> Factors(SmallestFactorLimit, 0);
+            std::vector<uint32_t> Primes;
+
+            for (uint32_t i = 2; i < SmallestFactorLimit; i++) {
+
+                uint32_t Smallest = Factors[i] ? Factors[i] : i;
+
+                if (!Factors[i]) {
+                    Primes.push_back(i);
+                }
+
+                // Each composite is written exactly once, as i times its smallest prime factor.
+                for (uint32_t Prime : Primes) {
+
+                    if (Prime > Smallest || uint64_t(i) * Prime >= SmallestFactorLimit) {
+                        break;
+                    }
+
+                    Factors[i * Prime] = static_cast<uint16_t>(Prime);
+
+                }
+
+            }
+
+            return Factors;
+
+        }();
+
+        return Table;
+
+    }
+
+    // Value is divisible by Prime exactly when Value * Inverse <= Limit, and the product is then the quotient.
+    struct TrialDivisor {
+        uint64_t Prime;
+        uint64_t Inverse;
+        uint64_t Limit;
+    };
+
+    // The odd primes below 1024.
+    constexpr std::array<TrialDivisor, 171> TrialDivisors = [] {
+
+        std::array<TrialDivisor, 171> Divisors{};
+        size_t Found = 0;
+
+        for (uint64_t Candidate = 3; Found < Divisors.size(); Candidate += 2) {
+
+            if (SLN::CompositeTable<1024>.IsComposite(Candidate)) {
+                continue;
+            }
+
+            uint64_t Inverse = Candidate;
+            for (int i = 0; i < 5; i++) {
+                Inverse *= 2 - Candidate * Inverse;
+            }
+
+            Divisors[Found++] = {Candidate, Inverse, UINT64_MAX / Candidate};
+
+        }
+
+        return Divisors;
+
+    }();
+
+    static_assert(TrialDivisors.back().Prime == 1021);
+
+    void FactorSmall(uint32_t Value, std::vector<uint64_t>& Factors) {
+
+        const std::vector<uint16_t>& Smallest = SmallestFactors();
+
+        while (Value > 1) {
+            uint32_t Factor = Smallest[Value] ? Smallest[Value] : Value;
+            Factors.push_back(Factor);
+            Value /= Factor;
+        }
+
+    }
+
+    /**
+     * @brief Finds a non-trivial factor of an odd composite with Brent's variant of Pollard's rho, iterating x^2 + c in Montgomery form.
+     *
+     * @note Differences are multiplied together in batches of 128 so there is one gcd per batch. If a batch overshoots to a gcd of Value, the
+     *       batch is replayed one step at a time, and if that also fails the next c is tried.
+     */
+    uint64_t PollardBrent(uint64_t Value) {
+
+        constexpr uint64_t BatchSize = 128;
+
+        SLN::Montgomery64 Field(Value);
+
+        for (uint64_t Constant = 1; ; Constant++) {
+
+            uint64_t Increment = Field.ToMontgomery(Constant);
+            auto Step = [&](uint64_t X) {
+                return Field.Add(Field.Square(X), Increment);
+            };
+
+            uint64_t Y = Field.ToMontgomery(2);
+            uint64_t X = Y;
+            uint64_t Saved = Y;
+            uint64_t Product = Field.One();
+            uint64_t Divisor = 1;
+
+            for (uint64_t Length = 1; Divisor == 1; Length *= 2) {
+
+                X = Y;
+                for (uint64_t i = 0; i < Length; i++) {
+                    Y = Step(Y);
+                }
+
+                for (uint64_t Done = 0; Done < Length && Divisor == 1; Done += BatchSize) {
+
+                    Saved = Y;
+
+                    for (uint64_t i = 0; i < std::min(BatchSize, Length - Done); i++) {
+                        Y = Step(Y);
+                        Product = Field.Multiply(Product, X > Y ? X - Y : Y - X);
+                    }
+
+                    Divisor = std::gcd(Product, Value);
+
+                }
+
+            }
+
+            if (Divisor == Value) {
+                do {
+                    Saved = Step(Saved);
+                    Divisor = std::gcd(X > Saved ? X - Saved : Saved - X, Value);
+                } while (Divisor == 1);
+            }
+
+            if (Divisor != Value) {
+                return Divisor;
+            }
+
+        }
+
+    }
+
+    /**
+     * @brief Factors a value with no prime factor below 1024.
+     */
+    void FactorLarge(uint64_t Value, std::vector<uint64_t>& Factors) {
+
+        if (SLN::IsPrime(Value)) {
+            Factors.push_back(Value);
+            return;
+        }
+
+        uint64_t Divisor = PollardBrent(Value);
+        FactorLarge(Divisor, Factors);
+        FactorLarge(Value / Divisor, Factors);
+
+    }
+
+    /**
+     * @brief Appends the prime factors of Value to Factors in ascending order.
+     */
+    void FactorInto(uint64_t Value, std::vector<uint64_t>& Factors) {
+
+        if (Value < SmallestFactorLimit) {
+            FactorSmall(static_cast<uint32_t>(Value), Factors);
+            return;
+        }
+
+        size_t Start = Factors.size();
+
+        int Twos = std::countr_zero(Value);
+        Factors.insert(Factors.end(), Twos, 2);
+        Value >>= Twos;
+
+        bool Exhausted = true;
+
+        for (const TrialDivisor& Divisor : TrialDivisors) {
+
+            if (Divisor.Prime * Divisor.Prime > Value) {
+                Exhausted = false;
+                break;
+            }
+
+            while (Value * Divisor.Inverse <= Divisor.Limit) {
+                Factors.push_back(Divisor.Prime);
+                Value *= Divisor.Inverse;
+            }
+
+        }
+
+        // Stopping early means no factor is left below the square root, so what remains is 1 or prime.
+        if (!Exhausted) {
+            if (Value > 1) {
+                Factors.push_back(Value);
+            }
+            return;
+        }
+
+        if (Value > 1) {
+            FactorLarge(Value, Factors);
+            std::sort(Factors.begin() + Start, Factors.end());
+        }
+
+    }
 
 }
 
+namespace SLN {
+
+    std::vector<uint64_t> Factorize(uint64_t Value) {
+
+        std::vector<uint64_t> Factors;
+        FactorInto(Value, Factors);
+        return Factors;
+
+    }
+
+    FactorTable FactorizeBatch(std::span<const uint64_t> Values) {
+
+        constexpr size_t BlockSize = 4096;
+
+        size_t Blocks = (Values.size() + BlockSize - 1) / BlockSize;
+        std::vector<std::vector<uint64_t>> BlockFactors(Blocks);
+
+        FactorTable Table;
+        Table.Offsets.assign(Values.size() + 1, 0);
+
+        // Each block collects its own factors, recording how many each value has, then the blocks are copied into place.
+        SLP::ParallelFor(Blocks, [&](size_t Begin, size_t End) {
+            for (size_t Block = Begin; Block < End; Block++) {
+
+                std::vector<uint64_t>& Factors = BlockFactors[Block];
+
+                for (size_t i = Block * BlockSize; i < std::min((Block + 1) * BlockSize, Values.size()); i++) {
+                    size_t Before = Factors.size();
+                    FactorInto(Values[i], Factors);
+                    Table.Offsets[i + 1] = Factors.size() - Before;
+                }
+
+            }
+        });
+
+        for (size_t i = 0; i < Values.size(); i++) {
+            Table.Offsets[i + 1] += Table.Offsets[i];
+        }
+
+        Table.Factors.resize(Table.Offsets.back());
+
+        SLP::ParallelFor(Blocks, [&](size_t Begin, size_t End) {
+            for (size_t Block = Begin; Block < End; Block++) {
+                std::copy(BlockFactors[Block].begin(), BlockFactors[Block].end(), Table.Factors.begin() + Table.Offsets[Block * BlockSize]);
+            }
+        });
+
+        return Table;
+
+    }
+
+}
@@ -1,5 +1,16 @@
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 #include <cstdlib>
@@ -10,6 +21,313 @@
 
 namespace SLN {
 
+/*
+==================================================================================================================================================================================
+MODULAR ARITHMETIC
+
+    64-bit modular arithmetic used by the primality and factorisation functions.
+
+==================================================================================================================================================================================
+*/
+
+#if defined(__SIZEOF_INT128__)
+    // __extension__ keeps -Wpedantic quiet about the non-standard type, which is then only ever named through this alias.
+    __extension__ typedef unsigned __int128 UInt128;
+#endif
+
+    /**
+     * @brief The high 64 bits of the 128-bit product of two 64-bit values.
+     */
+    constexpr uint64_t MulHigh(uint64_t Value1, uint64_t Value2) {
+
+#if defined(__SIZEOF_INT128__)
+        return static_cast<uint64_t>((static_cast<UInt128>(Value1) * Value2) >> 64);
+#else
+        uint64_t Low1 = static_cast<uint32_t>(Value1), High1 = Value1 >> 32;
+        uint64_t Low2 = static_cast<uint32_t>(Value2), High2 = Value2 >> 32;
+
+        uint64_t LowLow = Low1 * Low2;
+        uint64_t HighLow = High1 * Low2;
+        uint64_t LowHigh = Low1 * High2;
+
+        uint64_t Middle = (LowLow >> 32) + static_cast<uint32_t>(HighLow) + static_cast<uint32_t>(LowHigh);
+        return High1 * High2 + (HighLow >> 32) + (LowHigh >> 32) + (Middle >> 32);
+#endif
+
+    }
+
+    /**
+     * @brief Arithmetic modulo an odd 64-bit Modulus in Montgomery form (x is held as xR mod Modulus, R = 2^64), so products are reduced
+     *        with two multiplications and no division.
+     *
+     * @note Values passed to Multiply, Square and Power must already be in Montgomery form (see ToMontgomery), and results stay in [0, Modulus).
+     */
+    class Montgomery64 {
+
+        private:
+
+        uint64_t Modulus;
+        uint64_t Inverse;
+        uint64_t ROne;
+        uint64_t RSquared;
+
+        constexpr static uint64_t AddMod(uint64_t Value1, uint64_t Value2, uint64_t Modulus) {
+            return Value1 >= Modulus - Value2 ? Value1 - (Modulus - Value2) : Value1 + Value2;
+        }
+
+        public:
+
+        constexpr explicit Montgomery64(uint64_t OddModulus) : Modulus(OddModulus), Inverse(OddModulus), ROne((0 - OddModulus) % OddModulus), RSquared(0) {
+
+            // Newton's iteration doubles the correct low bits of the inverse each step, and an odd number is its own inverse modulo 8.
+            for (int i = 0; i < 5; i++) {
+                Inverse *= 2 - Modulus * Inverse;
+            }
+
+#if defined(__SIZEOF_INT128__)
+            RSquared = static_cast<uint64_t>(static_cast<UInt128>(ROne) * ROne % Modulus);
+#else
+            RSquared = ROne;
+            for (int i = 0; i < 64; i++) {
+                RSquared = AddMod(RSquared, RSquared, Modulus);
+            }
+#endif
+
+        }
+
+        constexpr uint64_t GetModulus() const {
+            return Modulus;
+        }
+
+        /**
+         * @brief Reduces the 128-bit value High * 2^64 + Low, returning (High * 2^64 + Low) / R mod Modulus. High must be below Modulus.
+         */
+        constexpr uint64_t Reduce(uint64_t High, uint64_t Low) const {
+
+            uint64_t Quotient = Low * Inverse;
+            uint64_t Product = MulHigh(Quotient, Modulus);
+
+            return High >= Product ? High - Product : High - Product + Modulus;
+
+        }
+
+        constexpr uint64_t Multiply(uint64_t Value1, uint64_t Value2) const {
+            return Reduce(MulHigh(Value1, Value2), Value1 * Value2);
+        }
+
+        constexpr uint64_t Square(uint64_t Value) const {
+            return Multiply(Value, Value);
+        }
+
+        constexpr uint64_t ToMontgomery(uint64_t Value) const {
+            return Multiply(Value % Modulus, RSquared);
+        }
+
+        constexpr uint64_t FromMontgomery(uint64_t Value) const {
+            return Reduce(0, Value);
+        }
+
+        constexpr uint64_t One() const {
+            return ROne;
+        }
+
+        constexpr uint64_t Add(uint64_t Value1, uint64_t Value2) const {
+            return AddMod(Value1, Value2, Modulus);
+        }
+
+        constexpr uint64_t Subtract(uint64_t Value1, uint64_t Value2) const {
+            return Value1 >= Value2 ? Value1 - Value2 : Value1 + (Modulus - Value2);
+        }
+
+        constexpr uint64_t Power(uint64_t Base, uint64_t Exponent) const {
+
+            uint64_t Result = One();
+
+            // The exponent's bits are close to random, so select the product rather than branching on each one.
+            while (Exponent) {
+                uint64_t Product = Multiply(Result, Base);
+                Result = (Exponent & 1) ? Product : Result;
+                Base = Square(Base);
+                Exponent >>= 1;
+            }
+
+            return Result;
+
+        }
+
+    };
+
+    /**
+     * @brief Deterministic Miller-Rabin primality test for any 64-bit value.
+     *
+     * @param Value The value to be checked, must be odd and above 2^16 (smaller values are answered by the lookup table in IsPrime).
+     * @return True if the number is prime, otherwise false.
+     * @note Values below 2^32 use the bases {2, 7, 61}, larger values the seven bases found by Jim Sinclair, which are known to have no strong
+     *       pseudoprimes below 2^64. Modular products use Montgomery multiplication, so the only divisions are in setting up Montgomery64.
+     */
+    constexpr bool MillerRabin(uint64_t Value) {
+
+        uint64_t OddPart = Value - 1;
+        int Twos = std::countr_zero(OddPart);
+        OddPart >>= Twos;
+
+        constexpr uint64_t SmallBases[3] = {2, 7, 61};
+        constexpr uint64_t LargeBases[7] = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+
+        std::span<const uint64_t> Bases = Value < (uint64_t(1) << 32) ? std::span<const uint64_t>(SmallBases) : std::span<const uint64_t>(LargeBases);
+
+        Montgomery64 Arithmetic(Value);
+        uint64_t One = Arithmetic.One();
+        uint64_t MinusOne = Value - One;
+
+        // Most composites are exposed by the first base, so bases are tried one at a time rather than side by side.
+        for (uint64_t Base : Bases) {
+
+            if (Base % Value == 0) continue;
+
+            uint64_t Result = Arithmetic.Power(Arithmetic.ToMontgomery(Base), OddPart);
+
+            if (Result == One || Result == MinusOne) continue;
+
+            bool Witness = true;
+            for (int i = 1; i < Twos && Witness; i++) {
+                Result = Arithmetic.Square(Result);
+                Witness = Result != MinusOne;
+            }
+
+            if (Witness) return false;
+
+        }
+
+        return true;
+
+    }
+
+/*
+==================================================================================================================================================================================
+LOOKUP TABLES
+
+    Tables computed at compile time.
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief A bitmap over [0, Limit) with bit n set if n is composite, sieved at compile time when declared constexpr.
+     *
+     * @tparam Limit One past the largest value covered.
+     * @note Large limits may exceed the compiler's default constexpr loop limit (262144 iterations on GCC), raise it with -fconstexpr-loop-limit if needed.
+     */
+    template <size_t Limit>
+    class CompositeBitmap {
+
+        private:
+
+        std::array<uint64_t, (Limit + 63) / 64> Words{};
+
+        constexpr void Set(size_t Value) {
+            Words[Value / 64] |= uint64_t(1) << (Value % 64);
+        }
+
+        public:
+
+        constexpr CompositeBitmap() {
+
+            for (size_t Factor = 2; Factor * Factor < Limit; Factor++) {
+
+                if (IsComposite(Factor)) {
+                    continue;
+                }
+
+                for (size_t Multiple = Factor * Factor; Multiple < Limit; Multiple += Factor) {
+                    Set(Multiple);
+                }
+
+            }
+
+        }
+
+        static constexpr size_t Size() {
+            return Limit;
+        }
+
+        /**
+         * @return True if Value is composite. Value must be below Limit.
+         */
+        constexpr bool IsComposite(size_t Value) const {
+            return (Words[Value / 64] >> (Value % 64)) & 1;
+        }
+
+        /**
+         * @return True if Value is prime. Value must be below Limit.
+         */
+        constexpr bool IsPrime(size_t Value) const {
+            return Value > 1 && !IsComposite(Value);
+        }
+
+        /**
+         * @brief Counts the composites in [0, Limit).
+         */
+        constexpr size_t CountComposites() const {
+
+            size_t Count = 0;
+
+            for (uint64_t Word : Words) {
+                Count += std::popcount(Word);
+            }
+
+            return Count;
+
+        }
+
+    };
+
+    /**
+     * @brief Values below SmallPrimeLimit are answered by IsPrime from this table instead of being tested.
+     */
+    inline constexpr size_t SmallPrimeLimit = size_t(1) << 16;
+    inline constexpr CompositeBitmap<SmallPrimeLimit> SmallPrimeTable{};
+
+    /**
+     * @brief A 32-bit divisibility test by an odd divisor d: x is a multiple of d exactly when x * Inverse (mod 2^32) <= Limit,
+     *        where Inverse is d^-1 mod 2^32 and Limit is (2^32 - 1) / d. Lanes can be tested with one multiply and compare, without division.
+     */
+    struct DivisibilityTest {
+        uint32_t Inverse;
+        uint32_t Limit;
+    };
+
+    template <size_t Count>
+    constexpr std::array<DivisibilityTest, Count> GenerateDivisibilityTests() {
+
+        std::array<DivisibilityTest, Count> Tests{};
+        CompositeBitmap<1024> Composites;
+
+        size_t Found = 0;
+        for (uint32_t Divisor = 3; Found < Count; Divisor += 2) {
+
+            if (Composites.IsComposite(Divisor)) {
+                continue;
+            }
+
+            uint32_t Inverse = Divisor;
+            for (int i = 0; i < 4; i++) {
+                Inverse *= 2 - Divisor * Inverse;
+            }
+
+            Tests[Found++] = {Inverse, 0xFFFFFFFFu / Divisor};
+
+        }
+
+        return Tests;
+
+    }
+
+    /**
+     * @brief Divisibility tests for the odd primes 3 to 113, used by IsPrimeBatch to discard most composites before Miller-Rabin.
+     */
+    inline constexpr std::array<DivisibilityTest, 29> SmallPrimeDivisibilityTests = GenerateDivisibilityTests<29>();
+
 /*
 ==================================================================================================================================================================================
 PREDICATE FUNCTIONS
@@ -28,7 +346,7 @@ PREDICATE FUNCTIONS
      * @note Outside of being objectively hilarious, this function can actually be used to identify NaN in non-integral types.
      */
     template <Numerical T>
-    bool IsItself(const T Value) {
+    constexpr bool IsItself(const T Value) {
         return Value == Value;
     }
 
@@ -40,7 +358,7 @@ PREDICATE FUNCTIONS
      * @return True if the number is even, otherwise false.
      */
     template <IntegralNumerical T>
-    bool IsEven(const T Value) {
+    constexpr bool IsEven(const T Value) {
         return (Value % 2 == 0);
     }
 
@@ -52,7 +370,7 @@ PREDICATE FUNCTIONS
      * @return True if the number is odd, otherwise false.
      */
     template <IntegralNumerical T>
-    bool IsOdd(const T Value) {
+    constexpr bool IsOdd(const T Value) {
         return !(Value % 2 == 0);
     }
 
@@ -64,7 +382,7 @@ PREDICATE FUNCTIONS
      * @return True if the number is above zero, otherwise false.
      */
     template <Numerical T>
-    bool IsPositive(const T Value) {
+    constexpr bool IsPositive(const T Value) {
         return (Value > 0); 
     }
 
@@ -76,7 +394,7 @@ PREDICATE FUNCTIONS
      * @return True if the number is above zero, otherwise false.
      */
     template <Numerical T>
-    bool IsNegative(const T Value) {
+    constexpr bool IsNegative(const T Value) {
         return (Value < 0);
     }
 
@@ -86,11 +404,41 @@ PREDICATE FUNCTIONS
      * @tparam T Any integral numerical type.
      * @param Value The value to be checked.
      * @return True if the number is prime, otherwise false.
+     * @note Built-in integers below 2^16 are looked up in a compile-time bitmap. Larger ones are trial divided by the primes up to 53 and then
+     *       checked with MillerRabin. Other types satisfying IntegralNumerical fall back to 6k ± 1 trial division.
      */
     template <IntegralNumerical T>
-    bool IsPrime(T Value) {
-        
+    constexpr bool IsPrime(T Value) {
+
         if (Value <= 1) return false;
+
+        if constexpr (std::integral<T>) {
+
+            if (static_cast<std::make_unsigned_t<T>>(Value) <= std::numeric_limits<uint64_t>::max()) {
+
+                uint64_t Unsigned = static_cast<uint64_t>(Value);
+
+                if (Unsigned < SmallPrimeLimit) {
+                    return SmallPrimeTable.IsPrime(Unsigned);
+                }
+
+                if (Unsigned % 2 == 0) {
+                    return false;
+                }
+
+                constexpr uint64_t SmallPrimes[15] = {3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+
+                bool Divisible = false;
+                for (uint64_t Prime : SmallPrimes) {
+                    Divisible |= Unsigned % Prime == 0;
+                }
+
+                return !Divisible && MillerRabin(Unsigned);
+
+            }
+
+        }
+
         if (Value <= 3) return true;
 
         if (IsEven(Value)) {
@@ -116,10 +464,88 @@ PREDICATE FUNCTIONS
      * @return True if the number is composite, otherwise false.
      */
     template <IntegralNumerical T>
-    bool IsComposite(T Value) {
+    constexpr bool IsComposite(T Value) {
         return Value > 1 && !IsPrime(Value);
     }
 
+    /**
+     * @brief Checks every value of a span for primality, writing 1 to Mask for primes and 0 otherwise.
+     *
+     * @tparam T Any integral numerical type.
+     * @param Values The values to be checked.
+     * @param Mask The output, must be at least as long as Values.
+     * @note Built-in integers of up to 32 bits are processed in blocks: every lane is tested against the odd primes up to 113 with
+     *       SmallPrimeDivisibilityTests, in loops the compiler can vectorise, and only the survivors (about one in nine) reach Miller-Rabin.
+     *       Wider types are checked one at a time with IsPrime.
+     */
+    template <IntegralNumerical T>
+    void IsPrimeBatch(std::span<const T> Values, std::span<uint8_t> Mask) {
+
+        if constexpr (std::integral<T> && sizeof(T) <= 4) {
+
+            constexpr size_t BlockSize = 1024;
+
+            uint32_t Block[BlockSize];
+            uint8_t Survivors[BlockSize];
+
+            for (size_t Base = 0; Base < Values.size(); Base += BlockSize) {
+
+                size_t Count = std::min(BlockSize, Values.size() - Base);
+
+                for (size_t i = 0; i < Count; i++) {
+                    if constexpr (std::is_signed_v<T>) {
+                        Block[i] = Values[Base + i] < 0 ? 0 : static_cast<uint32_t>(Values[Base + i]);
+                    } else {
+                        Block[i] = static_cast<uint32_t>(Values[Base + i]);
+                    }
+                }
+
+                // The final block is padded with zeros so every filtering loop has a constant trip count, which lets the compiler vectorise them without a scalar tail.
+                std::fill(Block + Count, Block + BlockSize, 0u);
+
+                for (size_t i = 0; i < BlockSize; i++) {
+                    Survivors[i] = Block[i] & 1;
+                }
+
+                for (const DivisibilityTest& Test : SmallPrimeDivisibilityTests) {
+                    for (size_t i = 0; i < BlockSize; i++) {
+                        Survivors[i] &= static_cast<uint8_t>(Block[i] * Test.Inverse > Test.Limit);
+                    }
+                }
+
+                for (size_t i = 0; i < Count; i++) {
+
+                    uint32_t Value = Block[i];
+
+                    if (Value < SmallPrimeLimit) {
+                        Mask[Base + i] = SmallPrimeTable.IsPrime(Value);
+                    } else {
+                        Mask[Base + i] = Survivors[i] && MillerRabin(Value);
+                    }
+
+                }
+
+            }
+
+        } else {
+
+            for (size_t i = 0; i < Values.size(); i++) {
+                Mask[i] = IsPrime(Values[i]);
+            }
+
+        }
+
+    }
+
+    template <IntegralNumerical T>
+    std::vector<uint8_t> IsPrimeBatch(std::span<const T> Values) {
+
+        std::vector<uint8_t> Mask(Values.size());
+        IsPrimeBatch(Values, std::span<uint8_t>(Mask));
+        return Mask;
+
+    }
+
 /*
 ==================================================================================================================================================================================
 COMPARTIVE FUNCTIONS
@@ -139,7 +565,7 @@ COMPARTIVE FUNCTIONS
      * @return True if the number is sum aligns with the expected sum, otherwise false.
      */
     template <Numerical T>
-    bool IsThisRight(const T Value1, const T Value2, const T ExpectedSum) {
+    constexpr bool IsThisRight(const T Value1, const T Value2, const T ExpectedSum) {
         return (Value1 + Value2) == ExpectedSum;
     }
 
@@ -153,7 +579,7 @@ COMPARTIVE FUNCTIONS
      * @return True if the number is within the defined range, otherwise false.
      */
     template <Numerical T>
-    bool InRange(const T Value, const T LowerBound, const T UpperBound) {
+    constexpr bool InRange(const T Value, const T LowerBound, const T UpperBound) {
         if (Value >= LowerBound && Value <= UpperBound) return true;
         return false;
     }
@@ -168,7 +594,7 @@ COMPARTIVE FUNCTIONS
      * @return True if the number is within the defined range, exclsuive, otherwise false.
      */
     template <Numerical T>
-    bool InRangeExclusive(const T Value, const T LowerBound, const T UpperBound) {
+    constexpr bool InRangeExclusive(const T Value, const T LowerBound, const T UpperBound) {
         if (Value > LowerBound && Value < UpperBound) return true;
         return false;
     }
@@ -182,12 +608,15 @@ COMPARTIVE FUNCTIONS
      * @return True if the numbers are approximately equal, otherwise false.
      */
     template <FloatingPoint T>
-    bool IsApproximatelyEqual(T Value1, T Value2) {
+    constexpr bool IsApproximatelyEqual(T Value1, T Value2) {
 
         T absEpsilon = std::numeric_limits<T>::epsilon() * 100;
         T relEpsilon = std::numeric_limits<T>::epsilon() * 10;
 
-        T Threshold = std::max(absEpsilon, relEpsilon * std::max(std::abs(Value1), std::abs(Value2)));
+        T Magnitude1 = Value1 < 0 ? -Value1 : Value1;
+        T Magnitude2 = Value2 < 0 ? -Value2 : Value2;
+
+        T Threshold = std::max(absEpsilon, relEpsilon * std::max(Magnitude1, Magnitude2));
 
         return(InRange(Value1, Value2 - Threshold, Value2 + Threshold));
 
@@ -202,7 +631,7 @@ COMPARTIVE FUNCTIONS
      * @return True if the numbers are factors of the each other, otherwise false.
      */
     template <Integral T>
-    bool IsDivisibleBy(T Numerator, T Denominator) {
+    constexpr bool IsDivisibleBy(T Numerator, T Denominator) {
         return Numerator % Denominator == 0;
     }
 
@@ -215,7 +644,7 @@ COMPARTIVE FUNCTIONS
      * @return Returns the quotient of the two values, else zero.
      */
     template <Integral T>
-    T GetQuotient(T Value, T Factor) {
+    constexpr T GetQuotient(T Value, T Factor) {
         if (!IsDivisibleBy(Value, Factor)) {
             return 0;
         }
@@ -238,7 +667,7 @@ OPERATIVE FUNCTIONS
      *
      */
     template <Numerical T>
-    T Add(T Value1, T Value2) {
+    constexpr T Add(T Value1, T Value2) {
 
         return Value1 + Value2;
 
@@ -249,7 +678,7 @@ OPERATIVE FUNCTIONS
      *
      */
     template <Numerical T>
-    T Square(T Value) {
+    constexpr T Square(T Value) {
 
         return Value * Value;
 
@@ -265,12 +694,758 @@ GENERATIVE FUNCTIONS
 ==================================================================================================================================================================================
 */
 
+    /**
+     * @brief A xoshiro256++ pseudo-random generator. It satisfies std::uniform_random_bit_generator, so it also works with the <random>
+     *        distributions and std::shuffle.
+     *
+     * @note Unlike rand() there is no shared state: each instance is independent, and ThreadRng gives every thread its own.
+     */
+    class Rng {
+
+        private:
+
+        uint64_t State[4];
+
+        friend class RngLanes;
+
+        static constexpr uint64_t RotateLeft(uint64_t Value, int Shift) {
+            return (Value << Shift) | (Value >> (64 - Shift));
+        }
+
+        static constexpr uint64_t SplitMix64(uint64_t& Seed) {
+
+            uint64_t Value = (Seed += 0x9E3779B97F4A7C15);
+            Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9;
+            Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EB;
+            return Value ^ (Value >> 31);
+
+        }
+
+        public:
+
+        using result_type = uint64_t;
+
+        constexpr explicit Rng(uint64_t SeedValue = 0, uint64_t Stream = 0) : State{} {
+            Seed(SeedValue, Stream);
+        }
+
+        /**
+         * @brief Restarts the generator. Equal seeds and streams give equal sequences, and different streams of one seed are unrelated.
+         *
+         * @note The state is expanded from the seed and stream with SplitMix64, as the xoshiro authors recommend, so it is never all zero.
+         */
+        constexpr void Seed(uint64_t SeedValue, uint64_t Stream = 0) {
+
+            uint64_t Mixer = Stream;
+            uint64_t Expander = SeedValue ^ SplitMix64(Mixer);
+
+            for (uint64_t& Word : State) {
+                Word = SplitMix64(Expander);
+            }
+
+        }
+
+        static constexpr result_type min() {
+            return 0;
+        }
+
+        static constexpr result_type max() {
+            return UINT64_MAX;
+        }
+
+        constexpr result_type operator()() {
+
+            uint64_t Result = RotateLeft(State[0] + State[3], 23) + State[0];
+            uint64_t Shifted = State[1] << 17;
+
+            State[2] ^= State[0];
+            State[3] ^= State[1];
+            State[1] ^= State[2];
+            State[0] ^= State[3];
+            State[2] ^= Shifted;
+            State[3] = RotateLeft(State[3], 45);
+
+            return Result;
+
+        }
+
+        /**
+         * @brief Advances the generator by 2^128 steps, equivalent to that many calls. Jumping copies of one generator gives non-overlapping streams.
+         */
+        constexpr void Jump() {
+
+            constexpr uint64_t Polynomial[4] = {0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C};
+            uint64_t Jumped[4] = {0, 0, 0, 0};
+
+            for (uint64_t Word : Polynomial) {
+                for (int Bit = 0; Bit < 64; Bit++) {
+
+                    if ((Word >> Bit) & 1) {
+                        for (int i = 0; i < 4; i++) {
+                            Jumped[i] ^= State[i];
+                        }
+                    }
+
+                    (*this)();
+
+                }
+            }
+
+            for (int i = 0; i < 4; i++) {
+                State[i] = Jumped[i];
+            }
+
+        }
+
+        /**
+         * @brief Returns an integer uniformly distributed over [Minimum, Maximum], both inclusive.
+         *
+         * @note Uses Lemire's multiply-shift: the high half of a 64 x 64-bit product picks the value, and the rare low halves that would
+         *       bias it are rejected. No division is done unless a low half falls in the biased zone.
+         */
+        template <std::integral T>
+        constexpr T UniformInt(T Minimum, T Maximum) {
+
+            using Unsigned = std::make_unsigned_t<T>;
+            uint64_t Range = static_cast<uint64_t>(static_cast<Unsigned>(static_cast<Unsigned>(Maximum) - static_cast<Unsigned>(Minimum)));
+
+            if (Range == UINT64_MAX) {
+                return static_cast<T>((*this)());
+            }
+
+            uint64_t Span = Range + 1;
+            uint64_t Random = (*this)();
+            uint64_t Low = Random * Span;
+
+            if (Low < Span) {
+                uint64_t Threshold = (0 - Span) % Span;
+                while (Low < Threshold) {
+                    Random = (*this)();
+                    Low = Random * Span;
+                }
+            }
+
+            return static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(Minimum) + static_cast<Unsigned>(MulHigh(Random, Span))));
+
+        }
+
+        /**
+         * @brief Returns a float uniformly distributed over [0, 1) with 23 random bits, made by placing them in the mantissa of a float in [1, 2).
+         */
+        constexpr float UniformFloat() {
+            return std::bit_cast<float>(0x3F800000u | static_cast<uint32_t>((*this)() >> 41)) - 1.0f;
+        }
+
+        /**
+         * @brief Returns a float uniformly distributed over [Minimum, Maximum).
+         */
+        constexpr float UniformFloat(float Minimum, float Maximum) {
+            return Minimum + UniformFloat() * (Maximum - Minimum);
+        }
+
+    };
+
+    /**
+     * @brief Returns the calling thread's generator, so threads never contend on shared state.
+     *
+     * @note Each thread draws its own stream of the seed last passed to SeedRng (a fixed default before any call). Which thread gets which
+     *       stream depends on the order threads first call ThreadRng, so runs are only repeatable from one thread. Use explicit Rng instances
+     *       when parallel output has to be reproducible.
+     */
+    Rng& ThreadRng();
+
+    /**
+     * @brief Reseeds every thread's ThreadRng. Each thread picks up the new seed on its next call to ThreadRng.
+     */
+    void SeedRng(uint64_t Seed);
+
+    /**
+     * @brief Returns a float uniformly distributed over [Minimum, Maximum) from the calling thread's ThreadRng.
+     */
     float RandFloatInRange(float Minimum, float Maximum);
+
+    /**
+     * @brief Eight xoshiro256++ generators stepped together, with their states stored lane by lane so the compiler can step them as one vector.
+     *
+     * @note The lanes are streams 0 to 7 of a single draw from the source generator, so the source advances by one step and equal source
+     *       states give equal lanes.
+     */
+    class RngLanes {
+
+        public:
+
+        static constexpr size_t Lanes = 8;
+
+        explicit RngLanes(Rng& Source) {
+
+            uint64_t Seed = Source();
+
+            for (size_t Lane = 0; Lane < Lanes; Lane++) {
+                Rng Stream(Seed, Lane);
+                for (int i = 0; i < 4; i++) {
+                    State[i][Lane] = Stream.State[i];
+                }
+            }
+
+        }
+
+        /**
+         * @brief Steps every lane once, writing lane i's output to Output[i].
+         */
+        void Next(uint64_t (&Output)[Lanes]) {
+
+            for (size_t Lane = 0; Lane < Lanes; Lane++) {
+
+                uint64_t Sum = State[0][Lane] + State[3][Lane];
+                Output[Lane] = ((Sum << 23) | (Sum >> 41)) + State[0][Lane];
+
+                uint64_t Shifted = State[1][Lane] << 17;
+
+                State[2][Lane] ^= State[0][Lane];
+                State[3][Lane] ^= State[1][Lane];
+                State[1][Lane] ^= State[2][Lane];
+                State[0][Lane] ^= State[3][Lane];
+                State[2][Lane] ^= Shifted;
+                State[3][Lane] = (State[3][Lane] << 45) | (State[3][Lane] >> 19);
+
+            }
+
+        }
+
+        private:
+
+        uint64_t State[4][Lanes];
+
+    };
+
+    /**
+     * @brief Fills Values with floats uniformly distributed over [Minimum, Maximum).
+     *
+     * @note Runs RngLanes and takes two 23-bit floats from each 64-bit output, converted as in Rng::UniformFloat, so there is no division.
+     *       The output depends only on Generator's state and the size of Values, so a seeded Rng reproduces it exactly.
+     */
+    void FillUniform(std::span<float> Values, float Minimum, float Maximum, Rng& Generator = ThreadRng());
+
+    /**
+     * @brief Fills Values with fair random bools, 64 from each generator output. Values needs contiguous storage, which std::vector<bool> lacks.
+     */
+    void FillUniform(std::span<bool> Values, Rng& Generator = ThreadRng());
+
+    /**
+     * @brief Fills Values with integers uniformly distributed over [Minimum, Maximum], both inclusive, e.g. SLN::FillUniform<int>(Rolls, 1, 6).
+     *
+     * @note Ranges of at most 2^32 values take two draws from each RngLanes output with Lemire's 32-bit multiply-shift, and the rare draw that
+     *       would be biased is redrawn from Generator. Wider ranges use one output per value with the 64-bit form. The threshold for
+     *       rejecting biased draws is computed once per call, so no value needs a division. Reproducible in the same way as the float version.
+     */
+    template <std::integral T>
+    requires (!std::same_as<T, bool>)
+    void FillUniform(std::span<T> Values, std::type_identity_t<T> Minimum, std::type_identity_t<T> Maximum, Rng& Generator = ThreadRng()) {
+
+        using Unsigned = std::make_unsigned_t<T>;
+        constexpr size_t Lanes = RngLanes::Lanes;
+
+        uint64_t Range = static_cast<uint64_t>(static_cast<Unsigned>(static_cast<Unsigned>(Maximum) - static_cast<Unsigned>(Minimum)));
+        Unsigned Offset = static_cast<Unsigned>(Minimum);
+
+        RngLanes Streams(Generator);
+        uint64_t Block[Lanes];
+
+        if (Range >= UINT32_MAX) {
+
+            uint64_t Span = Range + 1;
+            uint64_t Threshold = Span == 0 ? 0 : (0 - Span) % Span;
+
+            for (size_t i = 0; i < Values.size(); i += Lanes) {
+
+                Streams.Next(Block);
+
+                for (size_t Lane = 0; Lane < Lanes && i + Lane < Values.size(); Lane++) {
+
+                    if (Span == 0) {
+                        Values[i + Lane] = static_cast<T>(Block[Lane]);
+                    }
+                    else if (Block[Lane] * Span < Threshold) {
+                        Values[i + Lane] = Generator.UniformInt(static_cast<T>(Minimum), static_cast<T>(Maximum));
+                    }
+                    else {
+                        Values[i + Lane] = static_cast<T>(static_cast<Unsigned>(Offset + static_cast<Unsigned>(MulHigh(Block[Lane], Span))));
+                    }
+
+                }
+
+            }
+
+            return;
+
+        }
+
+        uint64_t Span = Range + 1;
+        uint32_t Threshold = static_cast<uint32_t>(((uint64_t(1) << 32) - Span) % Span);
+
+        T Buffer[2 * Lanes];
+
+        for (size_t i = 0; i < Values.size(); i += 2 * Lanes) {
+
+            Streams.Next(Block);
+
+            unsigned int Biased = 0;
+
+            // The high and low 32 bits of each output are separate draws.
+            for (size_t Lane = 0; Lane < Lanes; Lane++) {
+
+                uint64_t High = (Block[Lane] >> 32) * Span;
+                uint64_t Low = (Block[Lane] & 0xFFFFFFFF) * Span;
+
+                Biased |= (static_cast<uint32_t>(High) < Threshold) | (static_cast<uint32_t>(Low) < Threshold);
+
+                Buffer[Lane] = static_cast<T>(static_cast<Unsigned>(Offset + static_cast<Unsigned>(High >> 32)));
+                Buffer[Lanes + Lane] = static_cast<T>(static_cast<Unsigned>(Offset + static_cast<Unsigned>(Low >> 32)));
+
+            }
+
+            if (Biased) {
+                for (size_t Lane = 0; Lane < 2 * Lanes; Lane++) {
+                    uint64_t Random = Lane < Lanes ? Block[Lane] >> 32 : Block[Lane - Lanes] & 0xFFFFFFFF;
+                    if (static_cast<uint32_t>(Random * Span) < Threshold) {
+                        Buffer[Lane] = Generator.UniformInt(static_cast<T>(Minimum), static_cast<T>(Maximum));
+                    }
+                }
+            }
+
+            std::copy_n(Buffer, std::min(2 * Lanes, Values.size() - i), Values.begin() + i);
+
+        }
+
+    }
+
+    /**
+     * @brief Generates the first Count primes at compile time. See PrimeTable for a shared instance.
+     *
+     * @tparam Count The number of primes to generate.
+     * @return An array of the first Count primes, in ascending order, starting from 2.
+     * @note Sieves the odd numbers below n(ln n + ln ln n), an upper bound on the nth prime, with the logarithms over-estimated from the bit width of n.
+     */
+    template <size_t Count>
+    constexpr std::array<int, Count> GeneratePrimes() {
+
+        std::array<int, Count> Primes{};
+
+        if constexpr (Count > 0) {
+
+            double LogUpper = std::bit_width(Count) * 0.6932;
+            double LogLogUpper = std::bit_width(static_cast<size_t>(LogUpper) + 1) * 0.6932;
+            size_t Limit = std::max<size_t>(static_cast<size_t>(Count * (LogUpper + LogLogUpper)), 16);
+
+            // Index i of Composite represents the odd number 2i + 1.
+            std::vector<unsigned char> Composite(Limit / 2, 0);
+
+            Primes[0] = 2;
+            size_t Found = 1;
+
+            for (size_t i = 1; i < Composite.size() && Found < Count; i++) {
+
+                if (Composite[i]) {
+                    continue;
+                }
+
+                size_t Candidate = 2 * i + 1;
+                Primes[Found++] = static_cast<int>(Candidate);
+
+                for (size_t Multiple = Candidate * Candidate / 2; Multiple < Composite.size(); Multiple += Candidate) {
+                    Composite[Multiple] = 1;
+                }
+
+            }
+
+        }
+
+        return Primes;
+
+    }
+
+    /**
+     * @brief The first Count primes, computed once at compile time, e.g. SLN::PrimeTable<100>[24] == 97.
+     */
+    template <size_t Count>
+    inline constexpr std::array<int, Count> PrimeTable = GeneratePrimes<Count>();
+
+    /**
+     * @brief A shared CompositeBitmap over [0, Limit), computed once at compile time, e.g. SLN::CompositeTable<1024>.IsPrime(997).
+     */
+    template <size_t Limit>
+    inline constexpr CompositeBitmap<Limit> CompositeTable{};
+
+    /**
+     * @brief Generates the first Count composites at compile time.
+     *
+     * @return An array of the first Count composites, in ascending order, starting from 4.
+     */
+    template <size_t Count>
+    constexpr std::array<int, Count> GenerateComposites() {
+
+        std::array<int, Count> Composites{};
+        size_t Found = 0;
+
+        for (int Candidate = 4; Found < Count; Candidate++) {
+            if (IsComposite(Candidate)) {
+                Composites[Found++] = Candidate;
+            }
+        }
+
+        return Composites;
+
+    }
     
+    /**
+     * @brief Generates the first Limit primes, starting from 2.
+     *
+     * @note Uses a segmented, bit-packed sieve over a 2·3·5 wheel, with segments spread across the shared thread pool (SegLibParallel.h).
+     *       The sieve stops at NthPrime(Limit), so nothing beyond the last prime returned is sieved.
+     */
     std::vector<int> GeneratePrimes(size_t Limit);
 
+    /**
+     * @brief Generates the first Limit composites, starting from 4. Shares the sieve used by GeneratePrimes, and also stops at the last value returned.
+     */
     std::vector<int> GenerateComposites(size_t Limit);
 
+/*
+==================================================================================================================================================================================
+PRIME CACHE
+
+    A process-wide sieve shared between callers, see GetPrimeCache.
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief A bit-packed wheel sieve (the same layout GeneratePrimes uses) that grows on demand and is never recomputed.
+     *
+     * @note Each growth builds a new sieve from a copy of the last, sieving only the new range, and publishes it with an atomic pointer. Readers
+     *       take no lock: they load the pointer and read an immutable sieve. Superseded sieves are kept until the cache is destroyed, which at most
+     *       doubles memory use because every growth at least doubles the bound.
+     *       IsPrime and IsComposite never grow the cache. Values beyond the current bound fall back to SLN::IsPrime, so call Reserve first
+     *       to have a range answered from the sieve. The other queries grow it as needed.
+     */
+    class PrimeCache {
+
+        private:
+
+        // Primes counted per block of bytes, so counting and NthPrime only scan one block.
+        static constexpr size_t BlockBytes = 64;
+
+        struct Sieve {
+            uint64_t Limit = 0;
+            std::vector<uint8_t> Bytes;
+            std::vector<uint64_t> BlockCounts;
+        };
+
+        std::atomic<const Sieve*> Published{nullptr};
+        std::mutex GrowthLock;
+        std::vector<std::unique_ptr<Sieve>> Generations;
+
+        static bool SieveIsPrime(const Sieve& Current, uint64_t Value);
+        static uint64_t SieveCount(const Sieve& Current, uint64_t Maximum);
+
+        /**
+         * @brief Returns a sieve covering Maximum, growing the cache if the published one does not.
+         */
+        const Sieve& Acquire(uint64_t Maximum);
+
+        public:
+
+        PrimeCache();
+
+        PrimeCache(const PrimeCache&) = delete;
+        PrimeCache& operator=(const PrimeCache&) = delete;
+
+        /**
+         * @brief Grows the sieve to cover every value up to Maximum.
+         */
+        void Reserve(uint64_t Maximum);
+
+        /**
+         * @brief One past the largest value currently covered by the sieve.
+         */
+        uint64_t Bound() const;
+
+        bool IsPrime(uint64_t Value) const;
+
+        bool IsComposite(uint64_t Value) const;
+
+        /**
+         * @brief Counts the primes less than or equal to Maximum.
+         */
+        uint64_t CountPrimesUpTo(uint64_t Maximum);
+
+        /**
+         * @brief Returns the Index-th prime, counting from NthPrime(1) == 2. Returns 0 for Index 0.
+         */
+        uint64_t NthPrime(uint64_t Index);
+
+        /**
+         * @brief Returns every prime less than or equal to Maximum, in ascending order.
+         */
+        std::vector<uint64_t> PrimesUpTo(uint64_t Maximum);
+
+    };
+
+    /**
+     * @brief Returns the process-wide prime cache, created empty on first use.
+     */
+    PrimeCache& GetPrimeCache();
+
+/*
+==================================================================================================================================================================================
+PRIME COUNTING
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief Counts the primes less than or equal to Maximum.
+     *
+     * @note Small counts come from GetPrimeCache. Larger ones use Lehmer's formula, which only needs the cache sieved to 4 Maximum^(2/3),
+     *       e.g. pi(10^12) sieves to 4·10^8 rather than 10^12.
+     */
+    uint64_t PrimePi(uint64_t Maximum);
+
+    /**
+     * @brief Returns the Index-th prime, counting from NthPrime(1) == 2. Returns 0 for Index 0.
+     *
+     * @note Counts the primes below Dusart's lower bound on the answer with PrimePi, then sieves forward to it, a window well under 0.1% of the answer.
+     */
+    uint64_t NthPrime(uint64_t Index);
+
+/*
+==================================================================================================================================================================================
+PRIME STREAMS
+
+    Unbounded, lazily sieved sequences of primes and composites, see Primes and Composites.
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief A window of the wheel sieve (the layout GeneratePrimes uses) that slides forward over the integers.
+     *
+     * @note Memory is one segment of at most 32KB plus the sieving primes up to the square root of the window. The first window is 64 bytes, so a
+     *       single next prime is cheap, and each slide doubles it up to the full segment. Beyond StreamSieveLimit the sieving primes would grow
+     *       large, so windows stay at 64 bytes and are filled with SLN::IsPrime instead.
+     */
+    class SieveWindow {
+
+        private:
+
+        uint64_t Position;
+        uint64_t ByteBegin = 0;
+        std::vector<uint8_t> Bytes;
+        std::vector<uint32_t> Primes;
+        uint64_t PrimesLimit = 0;
+
+        /**
+         * @brief Moves the window to start at wheel byte Begin and marks its composites.
+         */
+        void Slide(uint64_t Begin);
+
+        public:
+
+        static constexpr uint64_t StreamSieveLimit = uint64_t(1) << 48;
+
+        /**
+         * @brief Starts the window at From. Nothing is sieved until the first value is asked for.
+         */
+        explicit SieveWindow(uint64_t From);
+
+        /**
+         * @brief Returns the smallest prime not yet passed, and moves past it. Valid up to the largest 64-bit prime, 2^64 - 59.
+         */
+        uint64_t NextPrime();
+
+        /**
+         * @brief Returns the smallest composite not yet passed, and moves past it.
+         */
+        uint64_t NextComposite();
+
+    };
+
+    /**
+     * @brief An unbounded input range over the values produced by a SieveWindow method, in ascending order.
+     *
+     * @tparam Advance &SieveWindow::NextPrime or &SieveWindow::NextComposite.
+     * @note Works with std::views, e.g. SLN::Primes() | std::views::take(10). Take and TakeUpTo collect values into a std::vector for SLV.
+     *       Like other input ranges it is consumed as it is read, so iterating again continues from where the last read stopped.
+     */
+    template <auto Advance>
+    class SieveRange : public std::ranges::view_interface<SieveRange<Advance>> {
+
+        private:
+
+        SieveWindow Window;
+        uint64_t Current;
+
+        public:
+
+        class Iterator {
+
+            private:
+
+            SieveRange* Range = nullptr;
+
+            public:
+
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = uint64_t;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+            explicit Iterator(SieveRange* Range) : Range(Range) {}
+
+            uint64_t operator*() const {
+                return Range->Current;
+            }
+
+            Iterator& operator++() {
+                Range->Current = (Range->Window.*Advance)();
+                return *this;
+            }
+
+            void operator++(int) {
+                ++*this;
+            }
+
+            friend bool operator==(const Iterator&, std::default_sentinel_t) {
+                return false;
+            }
+
+        };
+
+        explicit SieveRange(uint64_t From) : Window(From), Current((Window.*Advance)()) {}
+
+        Iterator begin() {
+            return Iterator(this);
+        }
+
+        std::default_sentinel_t end() const {
+            return std::default_sentinel;
+        }
+
+        /**
+         * @brief Returns the next value without consuming it.
+         */
+        uint64_t Peek() const {
+            return Current;
+        }
+
+        /**
+         * @brief Consumes and returns the next Count values.
+         */
+        template <std::integral T = uint64_t>
+        std::vector<T> Take(size_t Count) {
+
+            std::vector<T> Values;
+            Values.reserve(Count);
+
+            for (size_t i = 0; i < Count; i++) {
+                Values.push_back(static_cast<T>(Current));
+                Current = (Window.*Advance)();
+            }
+
+            return Values;
+
+        }
+
+        /**
+         * @brief Consumes and returns every value up to and including Maximum. The first value past Maximum is left unconsumed.
+         */
+        template <std::integral T = uint64_t>
+        std::vector<T> TakeUpTo(uint64_t Maximum) {
+
+            std::vector<T> Values;
+
+            while (Current <= Maximum) {
+                Values.push_back(static_cast<T>(Current));
+                Current = (Window.*Advance)();
+            }
+
+            return Values;
+
+        }
+
+    };
+
+    using PrimeRange = SieveRange<&SieveWindow::NextPrime>;
+    using CompositeRange = SieveRange<&SieveWindow::NextComposite>;
+
+    /**
+     * @brief Every prime, starting from 2.
+     */
+    inline PrimeRange Primes() {
+        return PrimeRange(0);
+    }
+
+    /**
+     * @brief Every prime greater than or equal to From, e.g. SLN::PrimesFrom(x).Peek() is the first prime at or after x.
+     */
+    inline PrimeRange PrimesFrom(uint64_t From) {
+        return PrimeRange(From);
+    }
+
+    /**
+     * @brief Every composite, starting from 4.
+     */
+    inline CompositeRange Composites() {
+        return CompositeRange(0);
+    }
+
+    /**
+     * @brief Every composite greater than or equal to From.
+     */
+    inline CompositeRange CompositesFrom(uint64_t From) {
+        return CompositeRange(From);
+    }
+
+/*
+==================================================================================================================================================================================
+FACTORIZATION
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief The prime factors of a batch of values, stored back to back. Entry i holds Factors[Offsets[i]] to Factors[Offsets[i + 1]].
+     */
+    struct FactorTable {
+
+        std::vector<uint64_t> Factors;
+        std::vector<size_t> Offsets{0};
+
+        std::span<const uint64_t> operator[](size_t Index) const {
+            return std::span<const uint64_t>(Factors).subspan(Offsets[Index], Offsets[Index + 1] - Offsets[Index]);
+        }
+
+        size_t size() const {
+            return Offsets.size() - 1;
+        }
+
+    };
+
+    /**
+     * @brief Returns the prime factors of Value with multiplicity, in ascending order, e.g. Factorize(12) == {2, 2, 3}. 0 and 1 have none.
+     *
+     * @note Values below 2^20 are read from a smallest-prime-factor table built once by a linear sieve. Larger values have the primes up to 1024
+     *       divided out, then any cofactor that is not prime (see IsPrime) is split with Pollard-Brent rho over Montgomery64.
+     */
+    std::vector<uint64_t> Factorize(uint64_t Value);
+
+    /**
+     * @brief Factorizes every value in Values in parallel on the shared thread pool (SegLibParallel.h).
+     *
+     * @return Entry i of the table holds what Factorize(Values[i]) would return.
+     */
+    FactorTable FactorizeBatch(std::span<const uint64_t> Values);
+
 }
 
 
@@ -1,6 +1,29 @@
 #include "SegLibConcepts.h"
-
+#include "SegLibParallel.h"
+#include "SegLibVector.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+#pragma once
 
 namespace SLO {
 
@@ -33,6 +56,7 @@ STRUCTURES AND CLASSES
 
         ClassType& ClassPtr;
         MemberType ClassType::*MemberTypePtr;
+        bool Dirty = false;
 
         public:
 
@@ -53,16 +77,534 @@ STRUCTURES AND CLASSES
             return &ClassPtr;
         }
 
+        MemberType ClassType::*GetMember() const {
+            return MemberTypePtr;
+        }
+
         ClassType CopyClass() {
             return ClassPtr;
         }
 
         void Restore() {
             Member = ClassPtr.*MemberTypePtr;
+            Dirty = false;
         }
 
         void Commit() {
             ClassPtr.*MemberTypePtr = Member;
+            Dirty = false;
+        }
+
+        /**
+         * @brief Tracked setter, assigns Member and marks it for CommitIfDirty.
+         */
+        void Set(const MemberType& Value) {
+            Member = Value;
+            Dirty = true;
+        }
+
+        void MarkDirty() {
+            Dirty = true;
+        }
+
+        bool IsDirty() const {
+            return Dirty;
+        }
+
+        /**
+         * @brief Commits Member only if it was changed through Set or marked with MarkDirty.
+         *
+         * @return True if the parent object was written to.
+         */
+        bool CommitIfDirty() {
+
+            if (!Dirty) {
+                return false;
+            }
+
+            Commit();
+            return true;
+
+        }
+
+    };
+
+    /**
+     * @brief A batched LinkedMember, holding one member of every object in a vector as a contiguous column.
+     *
+     * @tparam ClassType The class of the linked vector's elements, must have MemberType as an accessible member (not private).
+     * @tparam MemberType The type of the linked member.
+     * @note Members is a plain std::vector, so it can be passed straight to SLV functions. CommitAll and RestoreAll then write or re-read the
+     *       whole column in a single pass, rather than one LinkedMember at a time.
+     * @warning The linked vector must outlive the LinkedColumn. If the linked vector is resized, call RestoreAll before committing.
+     */
+    template <typename ClassType, typename MemberType>
+    requires HasAccessibleMember<ClassType, MemberType>
+    class LinkedColumn {
+
+        private:
+
+        std::vector<ClassType>* ObjectVectorPtr;
+        MemberType ClassType::*MemberTypePtr;
+
+        // Members as last read from, or written to, the linked vector.
+        std::vector<MemberType> Snapshot;
+        std::vector<uint64_t> DirtyWords;
+
+        void SetDirtyBit(size_t Index, bool Value) {
+
+            if (Index / 64 >= DirtyWords.size()) {
+                if (!Value) return;
+                DirtyWords.resize(Index / 64 + 1, 0);
+            }
+
+            uint64_t Bit = uint64_t(1) << (Index % 64);
+            DirtyWords[Index / 64] = Value ? (DirtyWords[Index / 64] | Bit) : (DirtyWords[Index / 64] & ~Bit);
+
+        }
+
+        /**
+         * @brief Checks that Index links a member to an object, and extends Snapshot to cover it, as Members is public and may have grown since
+         *        the last RestoreAll. New snapshot entries take the parent's current value.
+         */
+        void CheckLinked(size_t Index) {
+
+            if (Index >= Members.size() || Index >= ObjectVectorPtr->size()) {
+                throw std::out_of_range("SLO::LinkedColumn: Index has no linked object.");
+            }
+
+            for (size_t i = Snapshot.size(); i <= Index; i++) {
+                Snapshot.push_back((*ObjectVectorPtr)[i].*MemberTypePtr);
+            }
+
+        }
+
+        size_t CommittableCount() const {
+            return std::min({Members.size(), Snapshot.size(), ObjectVectorPtr->size()});
+        }
+
+        public:
+
+        std::vector<MemberType> Members;
+
+        LinkedColumn(std::vector<ClassType>& ParentVector, MemberType ClassType::*PtrToMember)
+
+        :   ObjectVectorPtr(&ParentVector),
+            MemberTypePtr(PtrToMember)
+
+        {
+            RestoreAll();
+        }
+
+        std::vector<ClassType>* GetVector() {
+            return ObjectVectorPtr;
+        }
+
+        size_t Size() const {
+            return Members.size();
+        }
+
+        /**
+         * @brief Re-reads the member of object Index into Members[Index].
+         *
+         * @throws std::out_of_range if Index is past the end of Members or of the linked vector.
+         */
+        void Restore(size_t Index) {
+            CheckLinked(Index);
+            Members[Index] = (*ObjectVectorPtr)[Index].*MemberTypePtr;
+            Snapshot[Index] = Members[Index];
+            SetDirtyBit(Index, false);
+        }
+
+        /**
+         * @brief Writes Members[Index] back to object Index.
+         *
+         * @throws std::out_of_range if Index is past the end of Members or of the linked vector.
+         */
+        void Commit(size_t Index) {
+            CheckLinked(Index);
+            (*ObjectVectorPtr)[Index].*MemberTypePtr = Members[Index];
+            Snapshot[Index] = Members[Index];
+            SetDirtyBit(Index, false);
+        }
+
+        /**
+         * @brief Tracked setter, assigns Members[Index] and marks it for CommitDirty.
+         */
+        void Set(size_t Index, const MemberType& Value) {
+            Members[Index] = Value;
+            SetDirtyBit(Index, true);
+        }
+
+        void MarkDirty(size_t Index) {
+            SetDirtyBit(Index, true);
+        }
+
+        bool IsDirty(size_t Index) const {
+            return Index / 64 < DirtyWords.size() && (DirtyWords[Index / 64] >> (Index % 64)) & 1;
+        }
+
+        /**
+         * @brief Re-reads the member from every object in the linked vector, resizing Members to match it. Clears all dirty marks.
+         */
+        void RestoreAll() {
+
+            std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+            Members.resize(ObjectVector.size());
+
+            for (size_t i = 0; i < ObjectVector.size(); i++) {
+                Members[i] = ObjectVector[i].*MemberTypePtr;
+            }
+
+            Snapshot = Members;
+            DirtyWords.assign((Members.size() + 63) / 64, 0);
+
+        }
+
+        /**
+         * @brief Writes every element of Members back to its parent object. Only the first min(Members.size(), linked vector size) elements are written.
+         */
+        void CommitAll() {
+
+            std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+            size_t Count = std::min(Members.size(), ObjectVector.size());
+
+            for (size_t i = 0; i < Count; i++) {
+                ObjectVector[i].*MemberTypePtr = Members[i];
+            }
+
+            Snapshot = Members;
+            DirtyWords.assign((Members.size() + 63) / 64, 0);
+
+        }
+
+        /**
+         * @brief Writes back only the elements changed through Set or marked with MarkDirty, then clears their marks.
+         *
+         * @return The number of parent objects written to.
+         */
+        size_t CommitDirty() {
+
+            std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+            size_t Count = CommittableCount();
+            size_t Written = 0;
+
+            for (size_t Word = 0; Word < DirtyWords.size(); Word++) {
+
+                uint64_t Mask = DirtyWords[Word];
+
+                while (Mask) {
+
+                    size_t Index = Word * 64 + std::countr_zero(Mask);
+
+                    // Marks past the committable range stay set, to be written once they have an object and a snapshot.
+                    if (Index >= Count) break;
+
+                    ObjectVector[Index].*MemberTypePtr = Members[Index];
+                    Snapshot[Index] = Members[Index];
+                    Written++;
+
+                    DirtyWords[Word] &= ~(uint64_t(1) << (Index % 64));
+                    Mask &= Mask - 1;
+
+                }
+
+            }
+
+            return Written;
+
+        }
+
+        /**
+         * @brief Writes back the elements that differ from their value when last restored or committed, found by comparing Members against a
+         *        snapshot, and the elements marked through Set or MarkDirty.
+         *
+         * @return The number of parent objects written to.
+         * @note The comparison runs over two contiguous arrays 64 elements at a time, so unchanged blocks are skipped without touching a single parent object.
+         *       Unlike CommitDirty, this also catches edits made directly to Members, e.g. by SLV functions.
+         */
+        size_t CommitChanged() requires EqualityCompatible<MemberType> {
+
+            std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+            size_t Count = CommittableCount();
+            size_t Written = 0;
+
+            for (size_t Base = 0; Base < Count; Base += 64) {
+
+                size_t BlockSize = std::min<size_t>(64, Count - Base);
+                uint64_t Mask = 0;
+
+                for (size_t j = 0; j < BlockSize; j++) {
+                    Mask |= uint64_t(!(Members[Base + j] == Snapshot[Base + j])) << j;
+                }
+
+                // Elements marked with MarkDirty or Set are written even if they compare equal to the snapshot. Only this block's marks are
+                // cleared, so marks past the committable range survive.
+                if (Base / 64 < DirtyWords.size()) {
+                    uint64_t BlockMask = BlockSize == 64 ? ~uint64_t(0) : (uint64_t(1) << BlockSize) - 1;
+                    Mask |= DirtyWords[Base / 64] & BlockMask;
+                    DirtyWords[Base / 64] &= ~BlockMask;
+                }
+
+                while (Mask) {
+
+                    size_t Index = Base + std::countr_zero(Mask);
+                    Mask &= Mask - 1;
+
+                    ObjectVector[Index].*MemberTypePtr = Members[Index];
+                    Snapshot[Index] = Members[Index];
+                    Written++;
+
+                }
+
+            }
+
+            return Written;
+
+        }
+
+    };
+
+    /**
+     * @brief Deduces the class and member type of a member object pointer.
+     */
+    template <typename MemberPointer>
+    struct MemberPointerTraits;
+
+    template <typename Class, typename Member>
+    struct MemberPointerTraits<Member Class::*> {
+        using ClassType = Class;
+        using MemberType = Member;
+    };
+
+    template <auto Member>
+    using MemberTypeOf = typename MemberPointerTraits<decltype(Member)>::MemberType;
+
+    /**
+     * @brief A column-oriented container of ClassType objects. Each listed member is stored contiguously in its own column, keyed by its member pointer.
+     *
+     * @tparam ClassType The class the columns are read from, must be default constructible so rows can be reconstructed.
+     * @tparam Members Pointers to the members of ClassType that are stored, e.g. &Card::Value. Members that are not listed are not stored.
+     * @note Columns are exposed as std::span, so bool members are not supported (std::vector<bool> is not contiguous). Use char or uint8_t instead.
+     */
+    template <typename ClassType, auto... Members>
+    requires (sizeof...(Members) > 0) &&
+             (std::is_same_v<typename MemberPointerTraits<decltype(Members)>::ClassType, ClassType> && ...) &&
+             std::default_initializable<ClassType>
+    class SoAVector {
+
+        static_assert((!std::is_same_v<MemberTypeOf<Members>, bool> && ...), "SoAVector columns cannot be bool, as std::vector<bool> is not contiguous.");
+
+        private:
+
+        std::tuple<std::vector<MemberTypeOf<Members>>...> Columns;
+
+        template <auto Candidate, auto Member>
+        static constexpr bool IsSameMember() {
+            if constexpr (std::is_same_v<decltype(Candidate), decltype(Member)>) {
+                return Candidate == Member;
+            } else {
+                return false;
+            }
+        }
+
+        template <auto Member>
+        static constexpr size_t ColumnIndex() {
+
+            size_t Index = 0;
+            size_t Found = sizeof...(Members);
+
+            ((Found = (Found == sizeof...(Members) && IsSameMember<Members, Member>()) ? Index : Found, Index++), ...);
+
+            return Found;
+
+        }
+
+        template <typename Function>
+        void ForEachColumn(Function Func) {
+            [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+                (Func(std::get<Indices>(Columns), Members), ...);
+            }(std::index_sequence_for<decltype(Members)...>());
+        }
+
+        template <typename Function>
+        void ForEachColumn(Function Func) const {
+            [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+                (Func(std::get<Indices>(Columns), Members), ...);
+            }(std::index_sequence_for<decltype(Members)...>());
+        }
+
+        public:
+
+        SoAVector() = default;
+
+        explicit SoAVector(const std::vector<ClassType>& ObjectVector) {
+
+            Reserve(ObjectVector.size());
+
+            for (const ClassType& CurrentElement : ObjectVector) {
+                PushBack(CurrentElement);
+            }
+
+        }
+
+        size_t Size() const {
+            return std::get<0>(Columns).size();
+        }
+
+        bool Empty() const {
+            return std::get<0>(Columns).empty();
+        }
+
+        void Reserve(size_t Capacity) {
+            ForEachColumn([&](auto& Column, auto) { Column.reserve(Capacity); });
+        }
+
+        void Clear() {
+            ForEachColumn([](auto& Column, auto) { Column.clear(); });
+        }
+
+        void PushBack(const ClassType& Object) {
+            ForEachColumn([&](auto& Column, auto Member) { Column.emplace_back(Object.*Member); });
+        }
+
+        /**
+         * @brief Reconstructs the object at Index. Members that are not stored are default initialised.
+         */
+        ClassType GetRow(size_t Index) const {
+
+            ClassType Object{};
+            ForEachColumn([&](const auto& Column, auto Member) { Object.*Member = Column[Index]; });
+            return Object;
+
+        }
+
+        /**
+         * @brief Writes the stored members of Object into row Index.
+         */
+        void SetRow(size_t Index, const ClassType& Object) {
+            ForEachColumn([&](auto& Column, auto Member) { Column[Index] = Object.*Member; });
+        }
+
+        std::vector<ClassType> ToVector() const {
+
+            std::vector<ClassType> ReturnVector;
+            ReturnVector.reserve(Size());
+
+            for (size_t i = 0; i < Size(); i++) {
+                ReturnVector.emplace_back(GetRow(i));
+            }
+
+            return ReturnVector;
+
+        }
+
+        template <auto Member>
+        std::span<MemberTypeOf<Member>> Column() {
+            static_assert(ColumnIndex<Member>() < sizeof...(Members), "Member is not stored in this SoAVector.");
+            return std::get<ColumnIndex<Member>()>(Columns);
+        }
+
+        template <auto Member>
+        std::span<const MemberTypeOf<Member>> Column() const {
+            static_assert(ColumnIndex<Member>() < sizeof...(Members), "Member is not stored in this SoAVector.");
+            return std::get<ColumnIndex<Member>()>(Columns);
+        }
+
+        /**
+         * @brief Returns the column storing Member, or an empty span if Member is not stored.
+         */
+        template <typename MemberType>
+        std::span<MemberType> Column(MemberType ClassType::*Member) {
+
+            std::span<MemberType> ReturnSpan;
+
+            ForEachColumn([&](auto& CurrentColumn, auto CurrentMember) {
+                if constexpr (std::is_same_v<decltype(CurrentMember), MemberType ClassType::*>) {
+                    if (CurrentMember == Member) ReturnSpan = CurrentColumn;
+                }
+            });
+
+            return ReturnSpan;
+
+        }
+
+        template <typename MemberType>
+        std::span<const MemberType> Column(MemberType ClassType::*Member) const {
+            return const_cast<SoAVector*>(this)->Column(Member);
+        }
+
+        template <typename MemberType>
+        bool Contains(MemberType ClassType::*Member) const {
+
+            bool Found = false;
+
+            ForEachColumn([&](const auto&, auto CurrentMember) {
+                if constexpr (std::is_same_v<decltype(CurrentMember), MemberType ClassType::*>) {
+                    if (CurrentMember == Member) Found = true;
+                }
+            });
+
+            return Found;
+
+        }
+
+        /**
+         * @brief Removes every row whose Keep entry is zero, preserving order.
+         *
+         * @param Keep One entry per row.
+         * @return The number of rows removed.
+         */
+        size_t Compact(const std::vector<unsigned char>& Keep) {
+
+            size_t OriginalSize = Size();
+            size_t Kept = 0;
+
+            ForEachColumn([&](auto& Column, auto) {
+
+                size_t Write = 0;
+
+                for (size_t Read = 0; Read < Column.size(); Read++) {
+                    if (Keep[Read]) {
+                        if (Write != Read) Column[Write] = std::move(Column[Read]);
+                        Write++;
+                    }
+                }
+
+                Column.resize(Write);
+                Kept = Write;
+
+            });
+
+            return OriginalSize - Kept;
+
+        }
+
+        /**
+         * @brief Creates a copy containing only the rows whose Keep entry is non-zero, preserving order.
+         */
+        SoAVector Select(const std::vector<unsigned char>& Keep) const {
+
+            SoAVector ReturnSoA;
+
+            [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+
+                auto CopyColumn = [&](const auto& Source, auto& Destination) {
+                    for (size_t i = 0; i < Source.size(); i++) {
+                        if (Keep[i]) Destination.emplace_back(Source[i]);
+                    }
+                };
+
+                (CopyColumn(std::get<Indices>(Columns), std::get<Indices>(ReturnSoA.Columns)), ...);
+
+            }(std::index_sequence_for<decltype(Members)...>());
+
+            return ReturnSoA;
+
         }
 
     };
@@ -666,12 +1208,22 @@ VECTOR FUNCTIONS
 
     }
 
+    /**
+     * @brief Calls a method taking no arguments on every object in a vector. See Invoke_p for methods with arguments and execution policies.
+     *
+     * @tparam ClassType The class the method belongs to.
+     * @tparam ClassMethod The method's function type, deduced from Method.
+     * @param ObjectVector A intentionally mutable reference to a vector of type ClassType.
+     * @param Method A pointer to the method, e.g. &SLO::LinkedMember<Card, int>::Commit.
+     */
     template<typename ClassType, typename ClassMethod>
+    requires std::is_member_function_pointer_v<ClassMethod ClassType::*> &&
+             std::invocable<ClassMethod ClassType::*, ClassType&>
     void Operate_p(std::vector<ClassType>& ObjectVector, ClassMethod ClassType::*Method) {
         
         for (ClassType& CurrentElement : ObjectVector) {
 
-            CurrentElement.*Method;
+            (CurrentElement.*Method)();
  
         }
 
@@ -721,6 +1273,40 @@ VECTOR EXTRACTION & CREATION FUNCTIONS
 
     }
 
+    /**
+     * @brief Commits every LinkedMember that was changed through Set or marked with MarkDirty, skipping the rest.
+     *
+     * @return The number of parent objects written to.
+     */
+    template<typename ClassType, typename MemberType>
+    requires HasAccessibleMember<ClassType, MemberType>
+    size_t CommitDirty(std::vector<LinkedMember<ClassType, MemberType>>& LinkedVector) {
+
+        size_t Written = 0;
+
+        for (LinkedMember<ClassType, MemberType>& CurrentElement : LinkedVector) {
+            Written += CurrentElement.CommitIfDirty() ? 1 : 0;
+        }
+
+        return Written;
+
+    }
+
+    /**
+     * @brief Creates a LinkedColumn over ObjectVector, the contiguous alternative to ExtractLinked.
+     *
+     * @tparam ClassType The class a given attribute is read from, must have MemberType as an accessible member (not private).
+     * @tparam MemberType The type of a given attribute.
+     * @param ObjectVector A intentionally mutable reference to the vector that will be linked to.
+     * @param Member A generic pointer to the desired attribute from instances of ClassType.
+     * @return A LinkedColumn whose Members hold a copy of Member from each object in ObjectVector.
+     */
+    template<typename ClassType, typename MemberType>
+    requires HasAccessibleMember<ClassType, MemberType>
+    LinkedColumn<ClassType, MemberType> ExtractLinkedColumn(std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member) {
+        return LinkedColumn<ClassType, MemberType>(ObjectVector, Member);
+    }
+
     template<typename ClassType, typename MemberType, typename Transformation, 
              typename T = std::invoke_result_t<Transformation, const MemberType&>>
     requires HasAccessibleMember<ClassType, MemberType> &&
@@ -840,7 +1426,7 @@ VECTOR DISTRIBUTION FUNCTIONS
 
             }
 
-            ReturnVector.emplace_back(CurrentDistribution);
+            ReturnVector.emplace_back(std::move(CurrentDistribution));
 
         }
 
@@ -893,7 +1479,7 @@ VECTOR DISTRIBUTION FUNCTIONS
 
             }
 
-            ReturnVector.emplace_back(CurrentDistribution);
+            ReturnVector.emplace_back(std::move(CurrentDistribution));
 
         }
 
@@ -920,6 +1506,3102 @@ VECTOR DISTRIBUTION FUNCTIONS
         return DistributeMember(ObjectVector, Member, Distributions, false);
     }
 
+    /**
+     * @brief Splits a vector into contiguous views without copying any elements.
+     *
+     * @tparam ClassType Any type.
+     * @param ObjectVector A constant reference to the vector that will be viewed. It must outlive, and not be resized during the lifetime of, the returned spans.
+     * @param Distributions The number of views to create.
+     * @param ForceEqualDistribution If true, the remainder of ObjectVector.size() / Distributions is left out of every view.
+     * @return A vector of Distributions spans (or a single span if Distributions <= 1).
+     * @note Chunk sizes match Distribute, the first (size % Distributions) views hold one extra element. Unlike Distribute, these extra elements are
+     *       taken from each view's own contiguous range rather than from the end of ObjectVector.
+     */
+    template<typename ClassType>
+    std::vector<std::span<const ClassType>>DistributeView(const std::vector<ClassType>& ObjectVector, size_t Distributions, bool ForceEqualDistribution) {
+
+        std::vector<std::span<const ClassType>> ReturnVector;
+        ReturnVector.reserve(Distributions);
+
+        if (Distributions <= 1) {
+            ReturnVector.emplace_back(ObjectVector);
+            return ReturnVector;
+        }
+
+        size_t Indices = ObjectVector.size() / Distributions;
+        size_t Remainder = ForceEqualDistribution ? 0 : ObjectVector.size() % Distributions;
+        size_t Index = 0;
+
+        for (size_t i = 0; i < Distributions; i++) {
+
+            size_t Count = Indices + (i < Remainder ? 1 : 0);
+            ReturnVector.emplace_back(ObjectVector.data() + Index, Count);
+            Index += Count;
+
+        }
+
+        return ReturnVector;
+
+    }
+
+    template<typename ClassType>
+    std::vector<std::span<const ClassType>>DistributeView(const std::vector<ClassType>& ObjectVector, size_t Distributions) {
+        return DistributeView(ObjectVector, Distributions, false);
+    }
+
+    /**
+     * @brief Splits a vector into contiguous mutable views without copying any elements, so each view can be worked on in place.
+     *
+     * @tparam ClassType Any type.
+     * @param ObjectVector A intentionally mutable reference to the vector that will be viewed. It must outlive, and not be resized during the lifetime of, the returned spans.
+     * @param Distributions The number of views to create.
+     * @param ForceEqualDistribution If true, the remainder of ObjectVector.size() / Distributions is left out of every view.
+     * @return A vector of Distributions mutable spans (or a single span if Distributions <= 1).
+     * @note See DistributeView for how the remainder is distributed.
+     */
+    template<typename ClassType>
+    std::vector<std::span<ClassType>>DistributeView_p(std::vector<ClassType>& ObjectVector, size_t Distributions, bool ForceEqualDistribution) {
+
+        std::vector<std::span<ClassType>> ReturnVector;
+        ReturnVector.reserve(Distributions);
+
+        if (Distributions <= 1) {
+            ReturnVector.emplace_back(ObjectVector);
+            return ReturnVector;
+        }
+
+        size_t Indices = ObjectVector.size() / Distributions;
+        size_t Remainder = ForceEqualDistribution ? 0 : ObjectVector.size() % Distributions;
+        size_t Index = 0;
+
+        for (size_t i = 0; i < Distributions; i++) {
+
+            size_t Count = Indices + (i < Remainder ? 1 : 0);
+            ReturnVector.emplace_back(ObjectVector.data() + Index, Count);
+            Index += Count;
+
+        }
+
+        return ReturnVector;
+
+    }
+
+    template<typename ClassType>
+    std::vector<std::span<ClassType>>DistributeView_p(std::vector<ClassType>& ObjectVector, size_t Distributions) {
+        return DistributeView_p(ObjectVector, Distributions, false);
+    }
+
+    /**
+     * @brief Splits a vector into contiguous views of roughly equal total cost, using prefix-sum partitioning.
+     *
+     * @tparam ClassType Any type.
+     * @tparam CostFunction Either a pointer to an arithmetic member of ClassType, or a function taking a const ClassType& and returning an arithmetic cost.
+     * @param ObjectVector A constant reference to the vector that will be viewed. It must outlive, and not be resized during the lifetime of, the returned spans.
+     * @param CostFunc The member or function giving each element's cost. Costs should not be negative.
+     * @param Distributions The number of views to create.
+     * @return A vector of Distributions spans (or a single span if Distributions <= 1). Views may be empty if a few elements dominate the total cost.
+     * @note An element is placed in a view if the midpoint of its cost falls within that view's share of the total, so boundaries land as close to
+     *       the ideal split as contiguity allows. CostFunc is evaluated once per element.
+     */
+    template<typename ClassType, typename CostFunction>
+    requires std::invocable<CostFunction, const ClassType&> &&
+             std::convertible_to<std::invoke_result_t<CostFunction, const ClassType&>, double>
+    std::vector<std::span<const ClassType>>DistributeWeighted(const std::vector<ClassType>& ObjectVector, CostFunction CostFunc, size_t Distributions) {
+
+        std::vector<std::span<const ClassType>> ReturnVector;
+        ReturnVector.reserve(Distributions);
+
+        if (Distributions <= 1) {
+            ReturnVector.emplace_back(ObjectVector);
+            return ReturnVector;
+        }
+
+        std::vector<double> Costs;
+        Costs.reserve(ObjectVector.size());
+
+        double TotalCost = 0;
+
+        for (const ClassType& CurrentElement : ObjectVector) {
+
+            Costs.emplace_back(static_cast<double>(std::invoke(CostFunc, CurrentElement)));
+            TotalCost += Costs.back();
+
+        }
+
+        double CumulativeCost = 0;
+        size_t Index = 0;
+
+        for (size_t i = 0; i < Distributions; i++) {
+
+            size_t Begin = Index;
+
+            if (i == Distributions - 1) {
+                Index = ObjectVector.size();
+            } else {
+
+                double Target = TotalCost * static_cast<double>(i + 1) / static_cast<double>(Distributions);
+
+                while (Index < ObjectVector.size() && CumulativeCost + Costs[Index] / 2 <= Target) {
+                    CumulativeCost += Costs[Index];
+                    Index++;
+                }
+
+            }
+
+            ReturnVector.emplace_back(ObjectVector.data() + Begin, Index - Begin);
+
+        }
+
+        return ReturnVector;
+
+    }
+
+    /**
+     * @brief Splits a vector into contiguous mutable views of roughly equal total cost. See DistributeWeighted.
+     */
+    template<typename ClassType, typename CostFunction>
+    requires std::invocable<CostFunction, const ClassType&> &&
+             std::convertible_to<std::invoke_result_t<CostFunction, const ClassType&>, double>
+    std::vector<std::span<ClassType>>DistributeWeighted_p(std::vector<ClassType>& ObjectVector, CostFunction CostFunc, size_t Distributions) {
+
+        std::vector<std::span<const ClassType>> ConstViews = DistributeWeighted(std::as_const(ObjectVector), CostFunc, Distributions);
+
+        std::vector<std::span<ClassType>> ReturnVector;
+        ReturnVector.reserve(ConstViews.size());
+
+        for (const std::span<const ClassType>& View : ConstViews) {
+            ReturnVector.emplace_back(ObjectVector.data() + (View.data() - ObjectVector.data()), View.size());
+        }
+
+        return ReturnVector;
+
+    }
+
+    /**
+     * @brief Copies the elements of a vector into Distributions vectors of roughly equal total cost, using greedy longest-processing-time assignment.
+     *
+     * @tparam ClassType Any type.
+     * @tparam CostFunction Either a pointer to an arithmetic member of ClassType, or a function taking a const ClassType& and returning an arithmetic cost.
+     * @param ObjectVector A constant reference to the vector that will be distributed.
+     * @param CostFunc The member or function giving each element's cost.
+     * @param Distributions The number of vectors to create.
+     * @return A vector of Distributions vectors (or a single vector if Distributions <= 1).
+     * @note Elements are assigned most expensive first, each to the currently cheapest vector, which bounds the most expensive vector at 4/3 of
+     *       the optimum. Within each vector, elements keep their original relative order. Unlike DistributeWeighted, distributions are not contiguous.
+     */
+    template<typename ClassType, typename CostFunction>
+    requires std::invocable<CostFunction, const ClassType&> &&
+             std::convertible_to<std::invoke_result_t<CostFunction, const ClassType&>, double>
+    std::vector<std::vector<ClassType>>DistributeBalanced(const std::vector<ClassType>& ObjectVector, CostFunction CostFunc, size_t Distributions) {
+
+        std::vector<std::vector<ClassType>> ReturnVector;
+        ReturnVector.reserve(Distributions);
+
+        if (Distributions <= 1) {
+            ReturnVector.emplace_back(ObjectVector);
+            return ReturnVector;
+        }
+
+        std::vector<std::pair<double, size_t>> Costs;
+        Costs.reserve(ObjectVector.size());
+
+        for (size_t i = 0; i < ObjectVector.size(); i++) {
+            Costs.emplace_back(static_cast<double>(std::invoke(CostFunc, ObjectVector[i])), i);
+        }
+
+        std::sort(Costs.begin(), Costs.end(), [](const auto& A, const auto& B) { return A.first > B.first; });
+
+        // Min-heap of (load, distribution).
+        std::vector<std::pair<double, size_t>> Loads;
+        Loads.reserve(Distributions);
+
+        for (size_t i = 0; i < Distributions; i++) {
+            Loads.emplace_back(0.0, i);
+        }
+
+        std::vector<std::vector<size_t>> Assignments(Distributions);
+
+        for (const auto& [Cost, Index] : Costs) {
+
+            std::pop_heap(Loads.begin(), Loads.end(), std::greater<>());
+            Loads.back().first += Cost;
+            Assignments[Loads.back().second].emplace_back(Index);
+            std::push_heap(Loads.begin(), Loads.end(), std::greater<>());
+
+        }
+
+        for (std::vector<size_t>& Assignment : Assignments) {
+
+            std::sort(Assignment.begin(), Assignment.end());
+
+            std::vector<ClassType> CurrentDistribution;
+            CurrentDistribution.reserve(Assignment.size());
+
+            for (size_t Index : Assignment) {
+                CurrentDistribution.emplace_back(ObjectVector[Index]);
+            }
+
+            ReturnVector.emplace_back(std::move(CurrentDistribution));
+
+        }
+
+        return ReturnVector;
+
+    }
+
+    /**
+     * @brief Copies the elements of a vector into Distributions vectors round-robin, so distribution i holds elements i, i + Distributions, i + 2 * Distributions...
+     *
+     * @tparam ClassType Any type.
+     * @param ObjectVector A constant reference to the vector that will be distributed.
+     * @param Distributions The number of vectors to create.
+     * @return A vector of Distributions vectors (or a single vector if Distributions <= 1).
+     * @note Useful when neighbouring elements have correlated cost, as each distribution samples evenly from the whole vector.
+     */
+    template<typename ClassType>
+    std::vector<std::vector<ClassType>>DistributeInterleaved(const std::vector<ClassType>& ObjectVector, size_t Distributions) {
+
+        std::vector<std::vector<ClassType>> ReturnVector;
+        ReturnVector.reserve(Distributions);
+
+        if (Distributions <= 1) {
+            ReturnVector.emplace_back(ObjectVector);
+            return ReturnVector;
+        }
+
+        for (size_t i = 0; i < Distributions; i++) {
+
+            std::vector<ClassType> CurrentDistribution;
+            CurrentDistribution.reserve(ObjectVector.size() / Distributions + 1);
+
+            for (size_t Index = i; Index < ObjectVector.size(); Index += Distributions) {
+                CurrentDistribution.emplace_back(ObjectVector[Index]);
+            }
+
+            ReturnVector.emplace_back(std::move(CurrentDistribution));
+
+        }
+
+        return ReturnVector;
+
+    }
+
+/*
+==================================================================================================================================================================================
+SELECTION FUNCTIONS
+
+    Inclusion and exclusion by position, see SLV::SelectionVector and SLV::Bitmask. Combine results with SLV::MaskAnd, SLV::MaskOr and SLV::MaskNot,
+    and copy the surviving objects once at the end with SLV::Gather.
+
+==================================================================================================================================================================================
+*/
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::equality_comparable_with<MemberType, ComparisonVariable>
+    SLV::SelectionVector EqualityInclusionIndices(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return ObjectVector[i].*Member == CompVar; });
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::equality_comparable_with<MemberType, ComparisonVariable>
+    SLV::Bitmask EqualityInclusionMask(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return ObjectVector[i].*Member == CompVar; });
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::equality_comparable_with<MemberType, ComparisonVariable>
+    SLV::SelectionVector EqualityExclusionIndices(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return ObjectVector[i].*Member != CompVar; });
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::equality_comparable_with<MemberType, ComparisonVariable>
+    SLV::Bitmask EqualityExclusionMask(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return ObjectVector[i].*Member != CompVar; });
+    }
+
+    template<typename ClassType, typename MemberType, typename Predicate>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Predicate, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+    SLV::SelectionVector ConditionalInclusionIndices(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, Predicate ConditionalFunc) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return static_cast<bool>(ConditionalFunc(ObjectVector[i].*Member)); });
+    }
+
+    template<typename ClassType, typename MemberType, typename Predicate>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Predicate, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+    SLV::Bitmask ConditionalInclusionMask(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, Predicate ConditionalFunc) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return static_cast<bool>(ConditionalFunc(ObjectVector[i].*Member)); });
+    }
+
+    template<typename ClassType, typename MemberType, typename Predicate>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Predicate, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+    SLV::SelectionVector ConditionalExclusionIndices(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, Predicate ConditionalFunc) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return !ConditionalFunc(ObjectVector[i].*Member); });
+    }
+
+    template<typename ClassType, typename MemberType, typename Predicate>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Predicate, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+    SLV::Bitmask ConditionalExclusionMask(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, Predicate ConditionalFunc) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return !ConditionalFunc(ObjectVector[i].*Member); });
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable, typename Comparative>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+    SLV::SelectionVector ComparativeInclusionIndices(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return static_cast<bool>(ComparativeFunc(ObjectVector[i].*Member, CompVar)); });
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable, typename Comparative>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+    SLV::Bitmask ComparativeInclusionMask(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return static_cast<bool>(ComparativeFunc(ObjectVector[i].*Member, CompVar)); });
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable, typename Comparative>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+    SLV::SelectionVector ComparativeExclusionIndices(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return !ComparativeFunc(ObjectVector[i].*Member, CompVar); });
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable, typename Comparative>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+    SLV::Bitmask ComparativeExclusionMask(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return !ComparativeFunc(ObjectVector[i].*Member, CompVar); });
+    }
+
+/*
+==================================================================================================================================================================================
+PARALLEL FUNCTIONS
+
+    Functions that distribute vectors across SegLib's shared thread pool
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief Splits a vector into chunks and invokes ChunkFunc on each of them across the shared thread pool, returning once every chunk has been processed.
+     *
+     * @tparam ClassType Any type.
+     * @tparam ChunkFunction Any function accepting a std::span<ClassType>.
+     * @param ObjectVector A intentionally mutable reference to the vector that will be processed.
+     * @param ChunkFunc The function invoked on each chunk. Chunks are disjoint, but may be processed concurrently.
+     * @param MinimumChunkSize The smallest chunk that will be handed to ChunkFunc, except for the final one.
+     * @throws Rethrows the first exception thrown by ChunkFunc once every chunk already started has finished. Chunks not yet started are skipped.
+     * @note Chunk sizes are not fixed, they shrink as the vector drains so that threads finishing cheap elements pick up the remaining work. See SLP::ParallelFor.
+     */
+    template<typename ClassType, typename ChunkFunction>
+    requires std::invocable<ChunkFunction, std::span<ClassType>>
+    void ParallelForChunks(std::vector<ClassType>& ObjectVector, ChunkFunction ChunkFunc, size_t MinimumChunkSize = 1) {
+
+        ClassType* Data = ObjectVector.data();
+
+        SLP::ParallelFor(ObjectVector.size(), [&](size_t Begin, size_t End) {
+            ChunkFunc(std::span<ClassType>(Data + Begin, End - Begin));
+        }, MinimumChunkSize);
+
+    }
+
+    template<typename ClassType, typename ChunkFunction>
+    requires std::invocable<ChunkFunction, std::span<const ClassType>>
+    void ParallelForChunks(const std::vector<ClassType>& ObjectVector, ChunkFunction ChunkFunc, size_t MinimumChunkSize = 1) {
+
+        const ClassType* Data = ObjectVector.data();
+
+        SLP::ParallelFor(ObjectVector.size(), [&](size_t Begin, size_t End) {
+            ChunkFunc(std::span<const ClassType>(Data + Begin, End - Begin));
+        }, MinimumChunkSize);
+
+    }
+
+    /**
+     * @brief Parallel equivalent of Operate_p, applies OperativeFunc to a member of every object across the shared thread pool.
+     *
+     * @tparam ClassType The class a given attribute is read from, must have MemberType as an accessible member (not private).
+     * @tparam MemberType The type of a given attribute, must be compatible with Operation.
+     * @tparam OperationVariable A variable that is compatible with Operation.
+     * @param ObjectVector A intentionally mutable reference to a vector of type ClassType.
+     * @param Member A generic pointer to the desired attribute from instances of ClassType.
+     * @param OperationVar The second argument passed to OperativeFunc.
+     * @param OperativeFunc A function taking the member and OperationVar, returning the member's new value. It may be invoked concurrently, exceptions propagate as in ParallelForChunks.
+     */
+    template<typename ClassType, typename MemberType,
+             typename OperationVariable,
+             typename Operation>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Operation, const MemberType&, const OperationVariable&> &&
+             std::convertible_to<std::invoke_result_t<Operation, MemberType&, const OperationVariable&>, MemberType>
+    void ParallelOperate_p(std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, const OperationVariable& OperationVar, Operation OperativeFunc) {
+
+        ParallelForChunks(ObjectVector, [&](std::span<ClassType> Chunk) {
+
+            for (ClassType& CurrentElement : Chunk) {
+
+                CurrentElement.*Member = OperativeFunc(CurrentElement.*Member, OperationVar);
+
+            }
+
+        });
+
+    }
+
+    template<typename ClassType, typename MemberType, typename Operation>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Operation, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Operation, MemberType&>, MemberType>
+    void ParallelOperate_p(std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, Operation OperativeFunc) {
+
+        ParallelForChunks(ObjectVector, [&](std::span<ClassType> Chunk) {
+
+            for (ClassType& CurrentElement : Chunk) {
+
+                CurrentElement.*Member = OperativeFunc(CurrentElement.*Member);
+
+            }
+
+        });
+
+    }
+
+/*
+==================================================================================================================================================================================
+STRUCTURE OF ARRAYS FUNCTIONS
+
+    SLO functions that work directly on the columns of an SoAVector
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief Returns the column storing Member.
+     *
+     * @throws std::invalid_argument if Member is not stored in ObjectVector. Without the check, filters on an unstored member would see an
+     *         empty column and remove every row.
+     */
+    template<typename ClassType, auto... Members, typename MemberType>
+    std::span<MemberType> RequireColumn(SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member) {
+
+        if (!ObjectVector.Contains(Member)) {
+            throw std::invalid_argument("SLO: Member is not stored in this SoAVector.");
+        }
+
+        return ObjectVector.Column(Member);
+
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType>
+    std::span<const MemberType> RequireColumn(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member) {
+        return RequireColumn(const_cast<SoAVector<ClassType, Members...>&>(ObjectVector), Member);
+    }
+
+    /**
+     * @brief Returns a view of the column storing Member. Unlike Extract on a std::vector, nothing is copied.
+     *
+     * @throws std::invalid_argument if Member is not stored in ObjectVector.
+     */
+    template<typename ClassType, auto... Members, typename MemberType>
+    std::span<const MemberType> Extract(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member) {
+        return RequireColumn(ObjectVector, Member);
+    }
+
+    /**
+     * @brief Builds a keep mask for ObjectVector by evaluating KeepFunc over the column storing Member.
+     *
+     * @throws std::invalid_argument if Member is not stored in ObjectVector, so the inclusion and exclusion functions never see a missing column.
+     */
+    template<typename ClassType, auto... Members, typename MemberType, typename KeepFunction>
+    std::vector<unsigned char> SoAMask(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, KeepFunction KeepFunc) {
+
+        std::span<const MemberType> Column = RequireColumn(ObjectVector, Member);
+
+        std::vector<unsigned char> Keep(ObjectVector.Size(), 0);
+
+        for (size_t i = 0; i < Column.size(); i++) {
+            Keep[i] = KeepFunc(Column[i]) ? 1 : 0;
+        }
+
+        return Keep;
+
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename ComparisonVariable>
+    requires std::equality_comparable_with<MemberType, ComparisonVariable>
+    SoAVector<ClassType, Members...> EqualityInclusion(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+        return ObjectVector.Select(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return Value == CompVar; }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename ComparisonVariable>
+    requires std::equality_comparable_with<MemberType, ComparisonVariable>
+    size_t EqualityInclusion_p(SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+        return ObjectVector.Compact(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return Value == CompVar; }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename ComparisonVariable>
+    requires std::equality_comparable_with<MemberType, ComparisonVariable>
+    SoAVector<ClassType, Members...> EqualityExclusion(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+        return ObjectVector.Select(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return Value != CompVar; }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename ComparisonVariable>
+    requires std::equality_comparable_with<MemberType, ComparisonVariable>
+    size_t EqualityExclusion_p(SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+        return ObjectVector.Compact(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return Value != CompVar; }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename Predicate>
+    requires std::invocable<Predicate, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+    SoAVector<ClassType, Members...> ConditionalInclusion(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, Predicate ConditionalFunc) {
+        return ObjectVector.Select(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return ConditionalFunc(Value); }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename Predicate>
+    requires std::invocable<Predicate, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+    size_t ConditionalInclusion_p(SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, Predicate ConditionalFunc) {
+        return ObjectVector.Compact(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return ConditionalFunc(Value); }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename Predicate>
+    requires std::invocable<Predicate, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+    SoAVector<ClassType, Members...> ConditionalExclusion(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, Predicate ConditionalFunc) {
+        return ObjectVector.Select(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return !ConditionalFunc(Value); }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename Predicate>
+    requires std::invocable<Predicate, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+    size_t ConditionalExclusion_p(SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, Predicate ConditionalFunc) {
+        return ObjectVector.Compact(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return !ConditionalFunc(Value); }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename ComparisonVariable, typename Comparative>
+    requires std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+    SoAVector<ClassType, Members...> ComparativeInclusion(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+        return ObjectVector.Select(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return ComparativeFunc(Value, CompVar); }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename ComparisonVariable, typename Comparative>
+    requires std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+    size_t ComparativeInclusion_p(SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+        return ObjectVector.Compact(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return ComparativeFunc(Value, CompVar); }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename ComparisonVariable, typename Comparative>
+    requires std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+    SoAVector<ClassType, Members...> ComparativeExclusion(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+        return ObjectVector.Select(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return !ComparativeFunc(Value, CompVar); }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename ComparisonVariable, typename Comparative>
+    requires std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+    size_t ComparativeExclusion_p(SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+        return ObjectVector.Compact(SoAMask(ObjectVector, Member, [&](const MemberType& Value) { return !ComparativeFunc(Value, CompVar); }));
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename OperationVariable, typename Operation>
+    requires std::invocable<Operation, const MemberType&, const OperationVariable&> &&
+             std::convertible_to<std::invoke_result_t<Operation, const MemberType&, const OperationVariable&>, MemberType>
+    SoAVector<ClassType, Members...> Operate(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, const OperationVariable& OperationVar, Operation OperativeFunc) {
+
+        SoAVector<ClassType, Members...> ReturnSoA = ObjectVector;
+        Operate_p(ReturnSoA, Member, OperationVar, OperativeFunc);
+        return ReturnSoA;
+
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename OperationVariable, typename Operation>
+    requires std::invocable<Operation, const MemberType&, const OperationVariable&> &&
+             std::convertible_to<std::invoke_result_t<Operation, MemberType&, const OperationVariable&>, MemberType>
+    void Operate_p(SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, const OperationVariable& OperationVar, Operation OperativeFunc) {
+
+        for (MemberType& CurrentElement : RequireColumn(ObjectVector, Member)) {
+            CurrentElement = OperativeFunc(CurrentElement, OperationVar);
+        }
+
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename Operation>
+    requires std::invocable<Operation, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Operation, const MemberType&>, MemberType>
+    SoAVector<ClassType, Members...> Operate(const SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, Operation OperativeFunc) {
+
+        SoAVector<ClassType, Members...> ReturnSoA = ObjectVector;
+        Operate_p(ReturnSoA, Member, OperativeFunc);
+        return ReturnSoA;
+
+    }
+
+    template<typename ClassType, auto... Members, typename MemberType, typename Operation>
+    requires std::invocable<Operation, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Operation, MemberType&>, MemberType>
+    void Operate_p(SoAVector<ClassType, Members...>& ObjectVector, MemberType ClassType::*Member, Operation OperativeFunc) {
+
+        for (MemberType& CurrentElement : RequireColumn(ObjectVector, Member)) {
+            CurrentElement = OperativeFunc(CurrentElement);
+        }
+
+    }
+
+/*
+==================================================================================================================================================================================
+INVOCATION FUNCTIONS
+
+    Functions that call methods across vectors of objects
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief Execution policies for ForEach, Invoke and Invoke_p.
+     *
+     *      Sequenced   - A plain loop on the calling thread.
+     *      Parallel    - Chunks of the vector run concurrently on the shared thread pool (see ParallelForChunks). If the function throws, the
+     *                    first exception is rethrown on the calling thread once every started chunk has finished.
+     *      Unsequenced - A loop on the calling thread that the compiler is told has no cross-iteration dependencies, so it may vectorise it.
+     *                    Only use this if the function does not touch shared state.
+     */
+    struct SequencedPolicy {};
+    struct ParallelPolicy {};
+    struct UnsequencedPolicy {};
+
+    inline constexpr SequencedPolicy Sequenced{};
+    inline constexpr ParallelPolicy Parallel{};
+    inline constexpr UnsequencedPolicy Unsequenced{};
+
+    template<typename Policy>
+    concept ExecutionPolicy =
+        std::same_as<Policy, SequencedPolicy> ||
+        std::same_as<Policy, ParallelPolicy> ||
+        std::same_as<Policy, UnsequencedPolicy>;
+
+    /**
+     * @brief Calls Func(ObjectVector[i]) on every index i under the given execution policy.
+     *
+     * @tparam Policy SequencedPolicy, ParallelPolicy or UnsequencedPolicy.
+     * @param ObjectVector The vector to iterate, may be const.
+     * @param Func Any function accepting an element of ObjectVector.
+     */
+    template<ExecutionPolicy Policy, typename VectorType, typename Function>
+    void ForEach(Policy, VectorType& ObjectVector, Function Func) {
+
+        auto* Data = ObjectVector.data();
+        size_t Size = ObjectVector.size();
+
+        if constexpr (std::is_same_v<Policy, ParallelPolicy>) {
+
+            SLP::ParallelFor(Size, [&](size_t Begin, size_t End) {
+                for (size_t i = Begin; i < End; i++) {
+                    Func(Data[i]);
+                }
+            });
+
+        } else if constexpr (std::is_same_v<Policy, UnsequencedPolicy>) {
+
+#if defined(__clang__)
+            #pragma clang loop vectorize(assume_safety)
+#elif defined(__GNUC__)
+            #pragma GCC ivdep
+#elif defined(_MSC_VER)
+            #pragma loop(ivdep)
+#endif
+            for (size_t i = 0; i < Size; i++) {
+                Func(Data[i]);
+            }
+
+        } else {
+
+            for (size_t i = 0; i < Size; i++) {
+                Func(Data[i]);
+            }
+
+        }
+
+    }
+
+    /**
+     * @brief Calls Method with Arguments on every object in a vector.
+     *
+     * @tparam Policy SequencedPolicy, ParallelPolicy or UnsequencedPolicy.
+     * @tparam ClassType The class the method belongs to.
+     * @tparam Method A pointer to a member function of ClassType.
+     * @param ObjectVector A intentionally mutable reference to a vector of type ClassType.
+     * @param MethodPtr The method to call, e.g. &Unit::TakeDamage.
+     * @param Arguments The arguments passed to every call, by constant reference.
+     * @note When Method is known at compile time, prefer Invoke_p<&ClassType::Method>(...), which lets the compiler inline the call into the loop.
+     */
+    template<ExecutionPolicy Policy, typename ClassType, typename Method, typename... Arguments>
+    requires std::is_member_function_pointer_v<Method> &&
+             std::invocable<Method, ClassType&, const Arguments&...>
+    void Invoke_p(Policy ExecPolicy, std::vector<ClassType>& ObjectVector, Method MethodPtr, const Arguments&... Args) {
+
+        ForEach(ExecPolicy, ObjectVector, [&](ClassType& CurrentElement) {
+            std::invoke(MethodPtr, CurrentElement, Args...);
+        });
+
+    }
+
+    template<typename ClassType, typename Method, typename... Arguments>
+    requires std::is_member_function_pointer_v<Method> &&
+             std::invocable<Method, ClassType&, const Arguments&...>
+    void Invoke_p(std::vector<ClassType>& ObjectVector, Method MethodPtr, const Arguments&... Args) {
+        Invoke_p(Sequenced, ObjectVector, MethodPtr, Args...);
+    }
+
+    /**
+     * @brief Invoke_p with the method as a template argument, e.g. SLO::Invoke_p<&Unit::TakeDamage>(Units, 10).
+     */
+    template<auto MethodPtr, ExecutionPolicy Policy, typename ClassType, typename... Arguments>
+    requires std::is_member_function_pointer_v<decltype(MethodPtr)> &&
+             std::invocable<decltype(MethodPtr), ClassType&, const Arguments&...>
+    void Invoke_p(Policy ExecPolicy, std::vector<ClassType>& ObjectVector, const Arguments&... Args) {
+
+        ForEach(ExecPolicy, ObjectVector, [&](ClassType& CurrentElement) {
+            std::invoke(MethodPtr, CurrentElement, Args...);
+        });
+
+    }
+
+    template<auto MethodPtr, typename ClassType, typename... Arguments>
+    requires std::is_member_function_pointer_v<decltype(MethodPtr)> &&
+             std::invocable<decltype(MethodPtr), ClassType&, const Arguments&...>
+    void Invoke_p(std::vector<ClassType>& ObjectVector, const Arguments&... Args) {
+        Invoke_p<MethodPtr>(Sequenced, ObjectVector, Args...);
+    }
+
+    /**
+     * @brief Stores Call(Object) for every object in a vector, in order. bool results are staged as uint8_t, since std::vector<bool> packs bits
+     *        and has no data() that separate threads can write into.
+     */
+    template<typename R, ExecutionPolicy Policy, typename ClassType, typename Callable>
+    std::vector<R> CollectResults(Policy ExecPolicy, const std::vector<ClassType>& ObjectVector, Callable Call) {
+
+        using Stored = std::conditional_t<std::is_same_v<R, bool>, uint8_t, R>;
+
+        std::vector<Stored> Staging(ObjectVector.size());
+        Stored* Results = Staging.data();
+        const ClassType* Data = ObjectVector.data();
+
+        ForEach(ExecPolicy, ObjectVector, [&](const ClassType& CurrentElement) {
+            Results[&CurrentElement - Data] = static_cast<Stored>(Call(CurrentElement));
+        });
+
+        if constexpr (std::is_same_v<R, bool>) {
+            return std::vector<bool>(Staging.begin(), Staging.end());
+        } else {
+            return Staging;
+        }
+
+    }
+
+    /**
+     * @brief Calls a const Method with Arguments on every object in a vector, collecting the results.
+     *
+     * @return A vector holding the result of each call, in the order of ObjectVector.
+     */
+    template<ExecutionPolicy Policy, typename ClassType, typename Method, typename... Arguments,
+             typename R = std::invoke_result_t<Method, const ClassType&, const Arguments&...>>
+    requires std::is_member_function_pointer_v<Method> &&
+             std::invocable<Method, const ClassType&, const Arguments&...> &&
+             std::default_initializable<R>
+    std::vector<R> Invoke(Policy ExecPolicy, const std::vector<ClassType>& ObjectVector, Method MethodPtr, const Arguments&... Args) {
+
+        return CollectResults<R>(ExecPolicy, ObjectVector, [&](const ClassType& CurrentElement) {
+            return std::invoke(MethodPtr, CurrentElement, Args...);
+        });
+
+    }
+
+    template<typename ClassType, typename Method, typename... Arguments,
+             typename R = std::invoke_result_t<Method, const ClassType&, const Arguments&...>>
+    requires std::is_member_function_pointer_v<Method> &&
+             std::invocable<Method, const ClassType&, const Arguments&...> &&
+             std::default_initializable<R>
+    std::vector<R> Invoke(const std::vector<ClassType>& ObjectVector, Method MethodPtr, const Arguments&... Args) {
+        return Invoke(Sequenced, ObjectVector, MethodPtr, Args...);
+    }
+
+    template<auto MethodPtr, ExecutionPolicy Policy, typename ClassType, typename... Arguments,
+             typename R = std::invoke_result_t<decltype(MethodPtr), const ClassType&, const Arguments&...>>
+    requires std::is_member_function_pointer_v<decltype(MethodPtr)> &&
+             std::default_initializable<R>
+    std::vector<R> Invoke(Policy ExecPolicy, const std::vector<ClassType>& ObjectVector, const Arguments&... Args) {
+
+        return CollectResults<R>(ExecPolicy, ObjectVector, [&](const ClassType& CurrentElement) {
+            return std::invoke(MethodPtr, CurrentElement, Args...);
+        });
+
+    }
+
+    template<auto MethodPtr, typename ClassType, typename... Arguments,
+             typename R = std::invoke_result_t<decltype(MethodPtr), const ClassType&, const Arguments&...>>
+    requires std::is_member_function_pointer_v<decltype(MethodPtr)> &&
+             std::default_initializable<R>
+    std::vector<R> Invoke(const std::vector<ClassType>& ObjectVector, const Arguments&... Args) {
+        return Invoke<MethodPtr>(Sequenced, ObjectVector, Args...);
+    }
+
+/*
+==================================================================================================================================================================================
+COMPILE-TIME MEMBER FUNCTIONS
+
+    Overloads of the SLO vector functions taking the member, and optionally the predicate or operation, as template arguments:
+
+        SLO::ConditionalInclusion<&Card::Value, SLN::IsEven<int>>(Cards);
+        SLO::Operate_p<&Card::Value, SLN::Add<int>>(Cards, 12);
+
+    The member offset and the function are then constants inside the loop, so the call is inlined and the loop can be vectorised, where the
+    runtime overloads must load the offset and call through a function pointer on every element. Any constant function works, including
+    function pointers, captureless lambdas and empty function objects such as std::less<>{}.
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief Satisfied when Member is a pointer to an accessible data member of ClassType.
+     */
+    template <auto Member, typename ClassType>
+    concept MemberOf = std::is_member_object_pointer_v<decltype(Member)> &&
+                       std::same_as<typename MemberPointerTraits<decltype(Member)>::ClassType, ClassType>;
+
+    /**
+     * @brief Copies the elements of ObjectVector for which Keep returns true, preserving order.
+     */
+    template<typename ClassType, typename KeepFunction>
+    std::vector<ClassType> CopyIf(const std::vector<ClassType>& ObjectVector, KeepFunction Keep) {
+
+        std::vector<ClassType> ReturnVector;
+        ReturnVector.reserve(ObjectVector.size());
+
+        for (const ClassType& CurrentElement : ObjectVector) {
+
+            if (Keep(CurrentElement)) {
+                ReturnVector.emplace_back(CurrentElement);
+            }
+
+        }
+
+        return ReturnVector;
+
+    }
+
+    /**
+     * @brief Removes the elements of ObjectVector for which Keep returns false, preserving order. Survivors are moved down in place, so nothing is reallocated.
+     *
+     * @return The number of elements removed from ObjectVector.
+     */
+    template<typename ClassType, typename KeepFunction>
+    size_t RetainIf_p(std::vector<ClassType>& ObjectVector, KeepFunction Keep) {
+
+        size_t Kept = 0;
+
+        for (size_t i = 0; i < ObjectVector.size(); i++) {
+
+            if (Keep(ObjectVector[i])) {
+                if (Kept != i) {
+                    ObjectVector[Kept] = std::move(ObjectVector[i]);
+                }
+                Kept++;
+            }
+
+        }
+
+        size_t ElementsRemoved = ObjectVector.size() - Kept;
+        ObjectVector.erase(ObjectVector.begin() + Kept, ObjectVector.end());
+
+        return ElementsRemoved;
+
+    }
+
+    template<auto Member, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::equality_comparable_with<MemberTypeOf<Member>, ComparisonVariable>
+    std::vector<ClassType> EqualityInclusion(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return CopyIf(ObjectVector, [&](const ClassType& CurrentElement) { return CurrentElement.*Member == CompVar; });
+    }
+
+    template<auto Member, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::equality_comparable_with<MemberTypeOf<Member>, ComparisonVariable>
+    size_t EqualityInclusion_p(std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return RetainIf_p(ObjectVector, [&](const ClassType& CurrentElement) { return CurrentElement.*Member == CompVar; });
+    }
+
+    template<auto Member, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::equality_comparable_with<MemberTypeOf<Member>, ComparisonVariable>
+    std::vector<ClassType> EqualityExclusion(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return CopyIf(ObjectVector, [&](const ClassType& CurrentElement) { return CurrentElement.*Member != CompVar; });
+    }
+
+    template<auto Member, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::equality_comparable_with<MemberTypeOf<Member>, ComparisonVariable>
+    size_t EqualityExclusion_p(std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return RetainIf_p(ObjectVector, [&](const ClassType& CurrentElement) { return CurrentElement.*Member != CompVar; });
+    }
+
+    template<auto Member, auto ConditionalFunc, typename ClassType>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ConditionalFunc), const MemberTypeOf<Member>&> &&
+             std::convertible_to<std::invoke_result_t<decltype(ConditionalFunc), const MemberTypeOf<Member>&>, bool>
+    std::vector<ClassType> ConditionalInclusion(const std::vector<ClassType>& ObjectVector) {
+        return CopyIf(ObjectVector, [](const ClassType& CurrentElement) { return static_cast<bool>(ConditionalFunc(CurrentElement.*Member)); });
+    }
+
+    template<auto Member, auto ConditionalFunc, typename ClassType>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ConditionalFunc), const MemberTypeOf<Member>&> &&
+             std::convertible_to<std::invoke_result_t<decltype(ConditionalFunc), const MemberTypeOf<Member>&>, bool>
+    size_t ConditionalInclusion_p(std::vector<ClassType>& ObjectVector) {
+        return RetainIf_p(ObjectVector, [](const ClassType& CurrentElement) { return static_cast<bool>(ConditionalFunc(CurrentElement.*Member)); });
+    }
+
+    template<auto Member, auto ConditionalFunc, typename ClassType>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ConditionalFunc), const MemberTypeOf<Member>&> &&
+             std::convertible_to<std::invoke_result_t<decltype(ConditionalFunc), const MemberTypeOf<Member>&>, bool>
+    std::vector<ClassType> ConditionalExclusion(const std::vector<ClassType>& ObjectVector) {
+        return CopyIf(ObjectVector, [](const ClassType& CurrentElement) { return !ConditionalFunc(CurrentElement.*Member); });
+    }
+
+    template<auto Member, auto ConditionalFunc, typename ClassType>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ConditionalFunc), const MemberTypeOf<Member>&> &&
+             std::convertible_to<std::invoke_result_t<decltype(ConditionalFunc), const MemberTypeOf<Member>&>, bool>
+    size_t ConditionalExclusion_p(std::vector<ClassType>& ObjectVector) {
+        return RetainIf_p(ObjectVector, [](const ClassType& CurrentElement) { return !ConditionalFunc(CurrentElement.*Member); });
+    }
+
+    template<auto Member, auto ComparativeFunc, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&>, bool>
+    std::vector<ClassType> ComparativeInclusion(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return CopyIf(ObjectVector, [&](const ClassType& CurrentElement) { return static_cast<bool>(ComparativeFunc(CurrentElement.*Member, CompVar)); });
+    }
+
+    template<auto Member, auto ComparativeFunc, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&>, bool>
+    size_t ComparativeInclusion_p(std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return RetainIf_p(ObjectVector, [&](const ClassType& CurrentElement) { return static_cast<bool>(ComparativeFunc(CurrentElement.*Member, CompVar)); });
+    }
+
+    template<auto Member, auto ComparativeFunc, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&>, bool>
+    std::vector<ClassType> ComparativeExclusion(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return CopyIf(ObjectVector, [&](const ClassType& CurrentElement) { return !ComparativeFunc(CurrentElement.*Member, CompVar); });
+    }
+
+    template<auto Member, auto ComparativeFunc, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&>, bool>
+    size_t ComparativeExclusion_p(std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return RetainIf_p(ObjectVector, [&](const ClassType& CurrentElement) { return !ComparativeFunc(CurrentElement.*Member, CompVar); });
+    }
+
+    template<auto Member, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::equality_comparable_with<MemberTypeOf<Member>, ComparisonVariable>
+    SLV::SelectionVector EqualityInclusionIndices(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return ObjectVector[i].*Member == CompVar; });
+    }
+
+    template<auto Member, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::equality_comparable_with<MemberTypeOf<Member>, ComparisonVariable>
+    SLV::Bitmask EqualityInclusionMask(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return ObjectVector[i].*Member == CompVar; });
+    }
+
+    template<auto Member, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::equality_comparable_with<MemberTypeOf<Member>, ComparisonVariable>
+    SLV::SelectionVector EqualityExclusionIndices(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return ObjectVector[i].*Member != CompVar; });
+    }
+
+    template<auto Member, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::equality_comparable_with<MemberTypeOf<Member>, ComparisonVariable>
+    SLV::Bitmask EqualityExclusionMask(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return ObjectVector[i].*Member != CompVar; });
+    }
+
+    template<auto Member, auto ConditionalFunc, typename ClassType>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ConditionalFunc), const MemberTypeOf<Member>&>
+    SLV::SelectionVector ConditionalInclusionIndices(const std::vector<ClassType>& ObjectVector) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return static_cast<bool>(ConditionalFunc(ObjectVector[i].*Member)); });
+    }
+
+    template<auto Member, auto ConditionalFunc, typename ClassType>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ConditionalFunc), const MemberTypeOf<Member>&>
+    SLV::Bitmask ConditionalInclusionMask(const std::vector<ClassType>& ObjectVector) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return static_cast<bool>(ConditionalFunc(ObjectVector[i].*Member)); });
+    }
+
+    template<auto Member, auto ConditionalFunc, typename ClassType>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ConditionalFunc), const MemberTypeOf<Member>&>
+    SLV::SelectionVector ConditionalExclusionIndices(const std::vector<ClassType>& ObjectVector) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return !ConditionalFunc(ObjectVector[i].*Member); });
+    }
+
+    template<auto Member, auto ConditionalFunc, typename ClassType>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ConditionalFunc), const MemberTypeOf<Member>&>
+    SLV::Bitmask ConditionalExclusionMask(const std::vector<ClassType>& ObjectVector) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return !ConditionalFunc(ObjectVector[i].*Member); });
+    }
+
+    template<auto Member, auto ComparativeFunc, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&>
+    SLV::SelectionVector ComparativeInclusionIndices(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return static_cast<bool>(ComparativeFunc(ObjectVector[i].*Member, CompVar)); });
+    }
+
+    template<auto Member, auto ComparativeFunc, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&>
+    SLV::Bitmask ComparativeInclusionMask(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return static_cast<bool>(ComparativeFunc(ObjectVector[i].*Member, CompVar)); });
+    }
+
+    template<auto Member, auto ComparativeFunc, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&>
+    SLV::SelectionVector ComparativeExclusionIndices(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return SLV::IndicesWhere(ObjectVector.size(), [&](size_t i) { return !ComparativeFunc(ObjectVector[i].*Member, CompVar); });
+    }
+
+    template<auto Member, auto ComparativeFunc, typename ClassType, typename ComparisonVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(ComparativeFunc), const MemberTypeOf<Member>&, const ComparisonVariable&>
+    SLV::Bitmask ComparativeExclusionMask(const std::vector<ClassType>& ObjectVector, const ComparisonVariable& CompVar) {
+        return SLV::MaskWhere(ObjectVector.size(), [&](size_t i) { return !ComparativeFunc(ObjectVector[i].*Member, CompVar); });
+    }
+
+    template<auto Member, auto OperativeFunc, typename ClassType, typename OperationVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(OperativeFunc), const MemberTypeOf<Member>&, const OperationVariable&> &&
+             std::convertible_to<std::invoke_result_t<decltype(OperativeFunc), const MemberTypeOf<Member>&, const OperationVariable&>, MemberTypeOf<Member>>
+    void Operate_p(std::vector<ClassType>& ObjectVector, const OperationVariable& OperationVar) {
+
+        ClassType* Data = ObjectVector.data();
+        size_t Size = ObjectVector.size();
+
+        for (size_t i = 0; i < Size; i++) {
+            Data[i].*Member = OperativeFunc(Data[i].*Member, OperationVar);
+        }
+
+    }
+
+    template<auto Member, auto OperativeFunc, typename ClassType, typename OperationVariable>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(OperativeFunc), const MemberTypeOf<Member>&, const OperationVariable&> &&
+             std::convertible_to<std::invoke_result_t<decltype(OperativeFunc), const MemberTypeOf<Member>&, const OperationVariable&>, MemberTypeOf<Member>>
+    std::vector<ClassType> Operate(const std::vector<ClassType>& ObjectVector, const OperationVariable& OperationVar) {
+
+        std::vector<ClassType> ReturnVector = ObjectVector;
+        Operate_p<Member, OperativeFunc>(ReturnVector, OperationVar);
+        return ReturnVector;
+
+    }
+
+    template<auto Member, auto OperativeFunc, typename ClassType>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(OperativeFunc), const MemberTypeOf<Member>&> &&
+             std::convertible_to<std::invoke_result_t<decltype(OperativeFunc), const MemberTypeOf<Member>&>, MemberTypeOf<Member>>
+    void Operate_p(std::vector<ClassType>& ObjectVector) {
+
+        ClassType* Data = ObjectVector.data();
+        size_t Size = ObjectVector.size();
+
+        for (size_t i = 0; i < Size; i++) {
+            Data[i].*Member = OperativeFunc(Data[i].*Member);
+        }
+
+    }
+
+    template<auto Member, auto OperativeFunc, typename ClassType>
+    requires MemberOf<Member, ClassType> &&
+             std::invocable<decltype(OperativeFunc), const MemberTypeOf<Member>&> &&
+             std::convertible_to<std::invoke_result_t<decltype(OperativeFunc), const MemberTypeOf<Member>&>, MemberTypeOf<Member>>
+    std::vector<ClassType> Operate(const std::vector<ClassType>& ObjectVector) {
+
+        std::vector<ClassType> ReturnVector = ObjectVector;
+        Operate_p<Member, OperativeFunc>(ReturnVector);
+        return ReturnVector;
+
+    }
+
+    template<auto Member, typename ClassType>
+    requires MemberOf<Member, ClassType>
+    std::vector<MemberTypeOf<Member>> Extract(const std::vector<ClassType>& ObjectVector) {
+
+        std::vector<MemberTypeOf<Member>> ReturnVector;
+        ReturnVector.reserve(ObjectVector.size());
+
+        for (const ClassType& CurrentElement : ObjectVector) {
+            ReturnVector.emplace_back(CurrentElement.*Member);
+        }
+
+        return ReturnVector;
+
+    }
+
+/*
+==================================================================================================================================================================================
+COLUMN CACHE
+
+    Memoised member extraction for vectors that are read far more often than they change
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief Memoises SLO::Extract results per (vector, member pointer) pair, so repeated extraction of an unchanged vector costs a lookup.
+     *
+     * @note Each vector has a version counter. Cached columns are rebuilt when the vector's version, address of its storage or size has changed
+     *       since they were built. Changes that keep the size and storage (e.g. writing a member directly) must be reported with MarkDirty,
+     *       or made through the Operate_p overloads taking a ColumnCache, which keep the affected column up to date.
+     * @note A ColumnCache is not thread safe. Returned columns stay valid until the same column is rebuilt or the cache is cleared.
+     */
+    class ColumnCache {
+
+        private:
+
+        struct CachedColumnBase {
+            virtual ~CachedColumnBase() = default;
+            uint64_t Version = 0;
+            const void* Data = nullptr;
+            size_t Size = 0;
+        };
+
+        template <typename MemberType>
+        struct CachedColumn : CachedColumnBase {
+            std::vector<MemberType> Values;
+        };
+
+        struct ColumnKey {
+            const void* Vector;
+            std::type_index MemberPointerType;
+            std::array<unsigned char, 16> MemberPointerBytes;
+
+            auto operator<=>(const ColumnKey&) const = default;
+        };
+
+        std::map<ColumnKey, std::unique_ptr<CachedColumnBase>> Columns;
+        std::map<const void*, uint64_t> VectorVersions;
+
+        template <typename ClassType, typename MemberType>
+        static ColumnKey MakeKey(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member) {
+
+            static_assert(sizeof(Member) <= 16, "Member pointer is too large to be used as a ColumnCache key.");
+
+            ColumnKey Key{&ObjectVector, std::type_index(typeid(Member)), {}};
+            std::memcpy(Key.MemberPointerBytes.data(), &Member, sizeof(Member));
+            return Key;
+
+        }
+
+        template <typename ClassType, typename MemberType>
+        CachedColumn<MemberType>& FindOrCreate(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member) {
+
+            std::unique_ptr<CachedColumnBase>& Entry = Columns[MakeKey(ObjectVector, Member)];
+
+            if (!Entry) {
+                Entry = std::make_unique<CachedColumn<MemberType>>();
+                Entry->Version = UINT64_MAX;
+            }
+
+            return static_cast<CachedColumn<MemberType>&>(*Entry);
+
+        }
+
+        template <typename ClassType>
+        void Stamp(CachedColumnBase& Column, const std::vector<ClassType>& ObjectVector) const {
+            Column.Version = Version(ObjectVector);
+            Column.Data = ObjectVector.data();
+            Column.Size = ObjectVector.size();
+        }
+
+        public:
+
+        /**
+         * @brief Returns the current version of ObjectVector. Versions start at zero and are incremented by MarkDirty.
+         */
+        template <typename ClassType>
+        uint64_t Version(const std::vector<ClassType>& ObjectVector) const {
+
+            auto Found = VectorVersions.find(&ObjectVector);
+            return Found == VectorVersions.end() ? 0 : Found->second;
+
+        }
+
+        /**
+         * @brief Returns the extracted column of Member, building it only if it is missing or stale.
+         *
+         * @return A reference to the cached column, equal to SLO::Extract(ObjectVector, Member).
+         */
+        template <typename ClassType, typename MemberType>
+        requires HasAccessibleMember<ClassType, MemberType>
+        const std::vector<MemberType>& Extract(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member) {
+
+            CachedColumn<MemberType>& Column = FindOrCreate(ObjectVector, Member);
+
+            if (Column.Version != Version(ObjectVector) || Column.Data != ObjectVector.data() || Column.Size != ObjectVector.size()) {
+                Column.Values = SLO::Extract(ObjectVector, Member);
+                Stamp(Column, ObjectVector);
+            }
+
+            return Column.Values;
+
+        }
+
+        /**
+         * @brief Returns the column of Member, stamped as valid for the current version of ObjectVector, for a caller that will fill it.
+         *
+         * @warning The caller must leave the column equal to SLO::Extract(ObjectVector, Member). Used by the Operate_p overloads below.
+         */
+        template <typename ClassType, typename MemberType>
+        requires HasAccessibleMember<ClassType, MemberType>
+        std::vector<MemberType>& Prepare(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member) {
+
+            CachedColumn<MemberType>& Column = FindOrCreate(ObjectVector, Member);
+            Column.Values.resize(ObjectVector.size());
+            Stamp(Column, ObjectVector);
+            return Column.Values;
+
+        }
+
+        /**
+         * @brief Invalidates every cached column of ObjectVector by incrementing its version.
+         */
+        template <typename ClassType>
+        void MarkDirty(const std::vector<ClassType>& ObjectVector) {
+            VectorVersions[&ObjectVector]++;
+        }
+
+        /**
+         * @brief Invalidates the cached column of Member only.
+         */
+        template <typename ClassType, typename MemberType>
+        requires HasAccessibleMember<ClassType, MemberType>
+        void MarkDirty(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member) {
+            Columns.erase(MakeKey(ObjectVector, Member));
+        }
+
+        /**
+         * @brief Releases every cached column of ObjectVector. Call this before ObjectVector is destroyed if its address may be reused.
+         */
+        template <typename ClassType>
+        void Forget(const std::vector<ClassType>& ObjectVector) {
+
+            for (auto Iterator = Columns.begin(); Iterator != Columns.end();) {
+                Iterator = (Iterator->first.Vector == &ObjectVector) ? Columns.erase(Iterator) : std::next(Iterator);
+            }
+
+            VectorVersions.erase(&ObjectVector);
+
+        }
+
+        void Clear() {
+            Columns.clear();
+            VectorVersions.clear();
+        }
+
+    };
+
+    /**
+     * @brief Operate_p that also refreshes Cache's column of Member in the same pass, leaving every other cached column of ObjectVector valid.
+     */
+    template<typename ClassType, typename MemberType,
+             typename OperationVariable,
+             typename Operation>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Operation, const MemberType&, const OperationVariable&> &&
+             std::convertible_to<std::invoke_result_t<Operation, MemberType&, const OperationVariable&>, MemberType>
+    void Operate_p(std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, const OperationVariable& OperationVar, Operation OperativeFunc, ColumnCache& Cache) {
+
+        std::vector<MemberType>& Column = Cache.Prepare(ObjectVector, Member);
+
+        for (size_t i = 0; i < ObjectVector.size(); i++) {
+
+            ObjectVector[i].*Member = OperativeFunc(ObjectVector[i].*Member, OperationVar);
+            Column[i] = ObjectVector[i].*Member;
+
+        }
+
+    }
+
+    template<typename ClassType, typename MemberType, typename Operation>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Operation, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Operation, MemberType&>, MemberType>
+    void Operate_p(std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member, Operation OperativeFunc, ColumnCache& Cache) {
+
+        std::vector<MemberType>& Column = Cache.Prepare(ObjectVector, Member);
+
+        for (size_t i = 0; i < ObjectVector.size(); i++) {
+
+            ObjectVector[i].*Member = OperativeFunc(ObjectVector[i].*Member);
+            Column[i] = ObjectVector[i].*Member;
+
+        }
+
+    }
+
+/*
+==================================================================================================================================================================================
+TRANSACTIONS
+
+    Coordinated linked member edits from several threads
+
+==================================================================================================================================================================================
+*/
+
+    enum class ConflictPolicy {
+        AbortOnConflict,    // If any parent was edited by more than one writer, nothing is committed.
+        SkipConflicts       // Parents edited by more than one writer are left untouched, every other edit is committed.
+    };
+
+    struct TransactionResult {
+        size_t Written = 0;
+        std::vector<size_t> Conflicts;  // Indices of parents staged by more than one writer, in ascending order.
+        bool Committed = false;
+    };
+
+    /**
+     * @brief Gathers edits to one member of a vector's objects from several threads, and applies them together at a sync point.
+     *
+     * @tparam ClassType The class of the linked vector's elements, must have MemberType as an accessible member (not private).
+     * @tparam MemberType The type of the edited member.
+     * @note Each thread stages through its own Writer, so staging needs no locking. Nothing touches the linked vector until Commit, so Rollback
+     *       is simply discarding the staged edits. A parent staged by two different writers is a conflict, handled according to a ConflictPolicy.
+     *       A writer staging the same parent more than once is not a conflict, its last edit wins.
+     * @warning Commit and Rollback must not run concurrently with staging.
+     */
+    template <typename ClassType, typename MemberType>
+    requires HasAccessibleMember<ClassType, MemberType>
+    class LinkedTransaction {
+
+        public:
+
+        class Writer {
+
+            friend class LinkedTransaction;
+
+            private:
+
+            struct Edit {
+                size_t Index;
+                MemberType Value;
+            };
+
+            const std::vector<ClassType>* ObjectVectorPtr;
+            std::vector<Edit> Edits;
+
+            explicit Writer(const std::vector<ClassType>* ParentVector) : ObjectVectorPtr(ParentVector) {}
+
+            public:
+
+            /**
+             * @throws std::out_of_range If Index is not an index of the transaction's vector.
+             */
+            void Stage(size_t Index, const MemberType& Value) {
+
+                if (Index >= ObjectVectorPtr->size()) {
+                    throw std::out_of_range("LinkedTransaction::Writer::Stage: index is outside the transaction's vector");
+                }
+
+                Edits.push_back(Edit{Index, Value});
+
+            }
+
+            /**
+             * @brief Stages Linked's current Member as an edit to its parent, which must be an element of the transaction's vector.
+             *
+             * @throws std::invalid_argument If Linked's parent is not an element of the transaction's vector.
+             */
+            void Stage(LinkedMember<ClassType, MemberType>& Linked) {
+
+                const ClassType* Parent = Linked.GetClass();
+                const ClassType* Begin = ObjectVectorPtr->data();
+                const ClassType* End = Begin + ObjectVectorPtr->size();
+
+                // std::less gives a total order over unrelated pointers, where the built in comparisons do not.
+                if (std::less<const ClassType*>()(Parent, Begin) || !std::less<const ClassType*>()(Parent, End)) {
+                    throw std::invalid_argument("LinkedTransaction::Writer::Stage: linked member's parent is not in the transaction's vector");
+                }
+
+                Edits.push_back(Edit{static_cast<size_t>(Parent - Begin), Linked.Member});
+
+            }
+
+            size_t Size() const {
+                return Edits.size();
+            }
+
+        };
+
+        private:
+
+        std::vector<ClassType>* ObjectVectorPtr;
+        MemberType ClassType::*MemberTypePtr;
+
+        std::mutex WritersLock;
+        std::deque<Writer> Writers;
+
+        public:
+
+        LinkedTransaction(std::vector<ClassType>& ParentVector, MemberType ClassType::*PtrToMember)
+
+        :   ObjectVectorPtr(&ParentVector),
+            MemberTypePtr(PtrToMember)
+
+        {
+
+        }
+
+        /**
+         * @brief Creates a staging buffer for the calling thread. The returned reference stays valid for the lifetime of the transaction.
+         */
+        Writer& CreateWriter() {
+            std::lock_guard<std::mutex> Guard(WritersLock);
+            return Writers.emplace_back(Writer(ObjectVectorPtr));
+        }
+
+        /**
+         * @brief Discards every staged edit. The linked vector is left untouched.
+         */
+        void Rollback() {
+            for (Writer& CurrentWriter : Writers) {
+                CurrentWriter.Edits.clear();
+            }
+        }
+
+        /**
+         * @brief Applies every staged edit, then clears them.
+         *
+         * @param Policy How parents staged by more than one writer are handled.
+         * @return The number of parents written, the conflicting parents, and whether anything was committed.
+         * @throws std::out_of_range If the vector has shrunk since an edit was staged past its new end. Nothing is written and the edits stay
+         *         staged, so the caller can Rollback.
+         * @note Edits are sorted by parent index, so after conflicts are resolved each parent is written at most once. The writes then cover
+         *       disjoint parts of the vector and are applied in parallel.
+         */
+        TransactionResult Commit(ConflictPolicy Policy = ConflictPolicy::AbortOnConflict) {
+
+            struct EditReference {
+                size_t Index;
+                uint32_t WriterIndex;
+                uint32_t Position;
+            };
+
+            std::vector<EditReference> References;
+
+            size_t TotalEdits = 0;
+            for (const Writer& CurrentWriter : Writers) {
+                TotalEdits += CurrentWriter.Edits.size();
+            }
+
+            References.reserve(TotalEdits);
+
+            for (size_t w = 0; w < Writers.size(); w++) {
+                for (size_t e = 0; e < Writers[w].Edits.size(); e++) {
+                    if (Writers[w].Edits[e].Index >= ObjectVectorPtr->size()) {
+                        throw std::out_of_range("LinkedTransaction::Commit: a staged index is outside the transaction's vector");
+                    }
+                    References.push_back(EditReference{Writers[w].Edits[e].Index, static_cast<uint32_t>(w), static_cast<uint32_t>(e)});
+                }
+            }
+
+            std::sort(References.begin(), References.end(), [](const EditReference& A, const EditReference& B) {
+                if (A.Index != B.Index) return A.Index < B.Index;
+                if (A.WriterIndex != B.WriterIndex) return A.WriterIndex < B.WriterIndex;
+                return A.Position < B.Position;
+            });
+
+            TransactionResult Result;
+            std::vector<EditReference> Winners;
+            Winners.reserve(References.size());
+
+            for (size_t Begin = 0; Begin < References.size();) {
+
+                size_t End = Begin + 1;
+                bool Conflict = false;
+
+                while (End < References.size() && References[End].Index == References[Begin].Index) {
+                    Conflict |= References[End].WriterIndex != References[Begin].WriterIndex;
+                    End++;
+                }
+
+                if (Conflict) {
+                    Result.Conflicts.push_back(References[Begin].Index);
+                } else {
+                    Winners.push_back(References[End - 1]);
+                }
+
+                Begin = End;
+
+            }
+
+            if (Policy == ConflictPolicy::AbortOnConflict && !Result.Conflicts.empty()) {
+                Rollback();
+                return Result;
+            }
+
+            std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+            SLP::ParallelFor(Winners.size(), [&](size_t Begin, size_t End) {
+
+                for (size_t i = Begin; i < End; i++) {
+                    const EditReference& Winner = Winners[i];
+                    ObjectVector[Winner.Index].*MemberTypePtr = Writers[Winner.WriterIndex].Edits[Winner.Position].Value;
+                }
+
+            }, 4096);
+
+            Result.Written = Winners.size();
+            Result.Committed = true;
+
+            Rollback();
+
+            return Result;
+
+        }
+
+    };
+
+/*
+==================================================================================================================================================================================
+QUERIES
+
+    Multi-member conditions evaluated in a single pass, e.g.
+
+        SLO::Where(Cards, SLO::Field(&Card::Suit) == 4 && SLO::Field(&Card::Value) > 10);
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief A condition on objects of ClassType, built from Field comparisons combined with &&, || and !.
+     *
+     * @note Queries remember how often each term passes and how long it takes. Where samples the vector and evaluates a plan with the terms of
+     *       every && and || reordered so the cheapest, most decisive checks run first. The plan is kept and reused until it has served
+     *       ReplanInterval filters or the pass rate Where observes drifts from the measured one, so settled queries are not re-measured every call.
+     *       Copies of a Query share these statistics and the plan. The terms themselves are never reordered in place and the statistics are
+     *       locked while updated, so a Query can be used by several threads at once.
+     */
+    template <typename ClassType>
+    class Query {
+
+        private:
+
+        enum class NodeKind { Term, And, Or, Not };
+
+        struct Node {
+            NodeKind Kind = NodeKind::Term;
+            std::function<bool(const ClassType&)> Term;
+            std::vector<std::shared_ptr<Node>> Children;
+
+            // Smoothed measurements, used to rank this node among its siblings. Guarded by StatisticsLock, as copies share nodes.
+            std::mutex StatisticsLock;
+            double PassRate = 0.5;
+            double NanosecondsPerEvaluation = 1.0;
+        };
+
+        struct Measurement {
+            std::shared_ptr<Node> Plan;
+            double PassRate;
+            double NanosecondsPerEvaluation;
+            double SampledPassRate;     // This sample alone, unsmoothed.
+        };
+
+        // The last plan measured for Root, shared by copies of the Query. Guarded by Lock.
+        struct PlanCache {
+            std::mutex Lock;
+            std::shared_ptr<Node> Plan;
+            double PassRate = 0.0;
+            size_t Uses = 0;
+        };
+
+        static constexpr size_t ReplanInterval = 64;
+        static constexpr double DriftTolerance = 0.1;
+
+        std::shared_ptr<Node> Root;
+        std::shared_ptr<PlanCache> Cache;
+
+        explicit Query(std::shared_ptr<Node> RootNode) : Root(std::move(RootNode)), Cache(std::make_shared<PlanCache>()) {}
+
+        static bool Evaluate(const Node& CurrentNode, const ClassType& Object) {
+
+            switch (CurrentNode.Kind) {
+
+                case NodeKind::Term:
+                    return CurrentNode.Term(Object);
+
+                case NodeKind::And:
+                    for (const std::shared_ptr<Node>& Child : CurrentNode.Children) {
+                        if (!Evaluate(*Child, Object)) return false;
+                    }
+                    return true;
+
+                case NodeKind::Or:
+                    for (const std::shared_ptr<Node>& Child : CurrentNode.Children) {
+                        if (Evaluate(*Child, Object)) return true;
+                    }
+                    return false;
+
+                case NodeKind::Not:
+                    return !Evaluate(*CurrentNode.Children.front(), Object);
+
+            }
+
+            return false;
+
+        }
+
+        /**
+         * @brief Measures CurrentNode on Sample, folds the result into its shared statistics, and returns a plan of it with && and || terms reordered.
+         *
+         * @note Terms are shared with the plan as they are never modified. Every &&, || and ! is copied, so reordering never touches a tree
+         *       another thread may be evaluating.
+         */
+        static Measurement Measure(const std::shared_ptr<Node>& CurrentNode, const std::vector<const ClassType*>& Sample) {
+
+            std::shared_ptr<Node> Plan = CurrentNode;
+
+            if (CurrentNode->Kind != NodeKind::Term) {
+
+                std::vector<Measurement> Children;
+                Children.reserve(CurrentNode->Children.size());
+
+                for (const std::shared_ptr<Node>& Child : CurrentNode->Children) {
+                    Children.push_back(Measure(Child, Sample));
+                }
+
+                if (CurrentNode->Kind == NodeKind::And || CurrentNode->Kind == NodeKind::Or) {
+
+                    // An && is cheapest when terms that fail cheaply run first, ranked by cost / P(fail). An || mirrors this with cost / P(pass).
+                    bool IsAnd = CurrentNode->Kind == NodeKind::And;
+
+                    auto Rank = [IsAnd](const Measurement& Child) {
+                        double Decisive = IsAnd ? 1.0 - Child.PassRate : Child.PassRate;
+                        return Child.NanosecondsPerEvaluation / std::max(Decisive, 1e-6);
+                    };
+
+                    std::stable_sort(Children.begin(), Children.end(), [&](const Measurement& A, const Measurement& B) {
+                        return Rank(A) < Rank(B);
+                    });
+
+                }
+
+                Plan = std::make_shared<Node>();
+                Plan->Kind = CurrentNode->Kind;
+                Plan->Children.reserve(Children.size());
+
+                for (Measurement& Child : Children) {
+                    Plan->Children.push_back(std::move(Child.Plan));
+                }
+
+            }
+
+            size_t Passes = 0;
+
+            auto Start = std::chrono::steady_clock::now();
+
+            for (const ClassType* Object : Sample) {
+                Passes += Evaluate(*Plan, *Object) ? 1 : 0;
+            }
+
+            auto Elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count();
+
+            constexpr double Smoothing = 0.5;
+            double SampledPassRate = static_cast<double>(Passes) / static_cast<double>(Sample.size());
+
+            std::lock_guard<std::mutex> Guard(CurrentNode->StatisticsLock);
+            CurrentNode->PassRate = Smoothing * CurrentNode->PassRate + (1 - Smoothing) * SampledPassRate;
+            CurrentNode->NanosecondsPerEvaluation = Smoothing * CurrentNode->NanosecondsPerEvaluation + (1 - Smoothing) * (Elapsed / static_cast<double>(Sample.size()));
+
+            return Measurement{std::move(Plan), CurrentNode->PassRate, CurrentNode->NanosecondsPerEvaluation, SampledPassRate};
+
+        }
+
+        static Query Combine(NodeKind Kind, const Query& Left, const Query& Right) {
+
+            std::shared_ptr<Node> Combined = std::make_shared<Node>();
+            Combined->Kind = Kind;
+
+            for (const Query* Operand : {&Left, &Right}) {
+                if (Operand->Root->Kind == Kind) {
+                    Combined->Children.insert(Combined->Children.end(), Operand->Root->Children.begin(), Operand->Root->Children.end());
+                } else {
+                    Combined->Children.push_back(Operand->Root);
+                }
+            }
+
+            return Query(Combined);
+
+        }
+
+        public:
+
+        /**
+         * @brief Creates a query from a single term.
+         *
+         * @param Predicate Any function taking a const ClassType& and returning a boolean.
+         */
+        template <typename Predicate>
+        requires std::invocable<Predicate, const ClassType&> &&
+                 std::convertible_to<std::invoke_result_t<Predicate, const ClassType&>, bool>
+        static Query FromPredicate(Predicate ConditionalFunc) {
+
+            std::shared_ptr<Node> Term = std::make_shared<Node>();
+            Term->Term = std::move(ConditionalFunc);
+            return Query(Term);
+
+        }
+
+        bool operator()(const ClassType& Object) const {
+            return Evaluate(*Root, Object);
+        }
+
+        /**
+         * @brief Measures every term on up to SampleSize objects, spread evenly across ObjectVector, and plans the query accordingly.
+         *
+         * @return An equivalent Query with && and || terms reordered by measured selectivity and cost. This Query's terms keep their order.
+         * @note The plan is also cached for Plan below.
+         */
+        Query Optimise(const std::vector<ClassType>& ObjectVector, size_t SampleSize = 256) const {
+
+            if (ObjectVector.empty() || SampleSize == 0) {
+                return *this;
+            }
+
+            SampleSize = std::min(SampleSize, ObjectVector.size());
+
+            std::vector<const ClassType*> Sample;
+            Sample.reserve(SampleSize);
+
+            for (size_t i = 0; i < SampleSize; i++) {
+                Sample.push_back(&ObjectVector[i * ObjectVector.size() / SampleSize]);
+            }
+
+            Measurement Measured = Measure(Root, Sample);
+
+            std::lock_guard<std::mutex> Guard(Cache->Lock);
+            Cache->Plan = Measured.Plan;
+            Cache->PassRate = Measured.SampledPassRate;
+            Cache->Uses = 0;
+
+            return Query(std::move(Measured.Plan));
+
+        }
+
+        /**
+         * @brief Returns the cached plan, re-measuring through Optimise only when there is none or it has served ReplanInterval calls.
+         *
+         * @note Vectors of at most SampleSize objects are never measured, as sampling would cost about as much as filtering them. They use the
+         *       cached plan if there is one, and the terms in written order otherwise.
+         */
+        Query Plan(const std::vector<ClassType>& ObjectVector, size_t SampleSize = 256) const {
+
+            {
+                std::lock_guard<std::mutex> Guard(Cache->Lock);
+
+                if (Cache->Plan && (Cache->Uses < ReplanInterval || ObjectVector.size() <= SampleSize)) {
+                    Cache->Uses++;
+                    return Query(Cache->Plan);
+                }
+            }
+
+            if (ObjectVector.size() <= SampleSize) {
+                return *this;
+            }
+
+            return Optimise(ObjectVector, SampleSize);
+
+        }
+
+        /**
+         * @brief Reports that a plan of this query passed Passed of Evaluated objects. If that strays more than DriftTolerance from the pass rate
+         *        of the sample the plan was measured on, the cached plan is dropped and the next Plan call re-measures.
+         */
+        void Record(size_t Evaluated, size_t Passed) const {
+
+            if (Evaluated == 0) {
+                return;
+            }
+
+            double Observed = static_cast<double>(Passed) / static_cast<double>(Evaluated);
+
+            std::lock_guard<std::mutex> Guard(Cache->Lock);
+
+            if (Cache->Plan && std::abs(Observed - Cache->PassRate) > DriftTolerance) {
+                Cache->Plan = nullptr;
+            }
+
+        }
+
+        friend Query operator&&(const Query& Left, const Query& Right) {
+            return Combine(NodeKind::And, Left, Right);
+        }
+
+        friend Query operator||(const Query& Left, const Query& Right) {
+            return Combine(NodeKind::Or, Left, Right);
+        }
+
+        friend Query operator!(const Query& Operand) {
+
+            std::shared_ptr<Node> Negation = std::make_shared<Node>();
+            Negation->Kind = NodeKind::Not;
+            Negation->Children.push_back(Operand.Root);
+            return Query(Negation);
+
+        }
+
+    };
+
+    /**
+     * @brief A member of ClassType that can be compared to build a Query, e.g. SLO::Field(&Card::Value) > 10.
+     */
+    template <typename ClassType, typename MemberType>
+    requires HasAccessibleMember<ClassType, MemberType>
+    struct FieldReference {
+
+        MemberType ClassType::*Member;
+
+        template <typename Predicate>
+        requires std::invocable<Predicate, const MemberType&> &&
+                 std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+        Query<ClassType> Satisfies(Predicate ConditionalFunc) const {
+            return Query<ClassType>::FromPredicate([Member = Member, ConditionalFunc](const ClassType& Object) { return static_cast<bool>(ConditionalFunc(Object.*Member)); });
+        }
+
+        template <typename ComparisonVariable, typename Comparative>
+        requires std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+                 std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+        Query<ClassType> Satisfies(const ComparisonVariable& CompVar, Comparative ComparativeFunc) const {
+            return Query<ClassType>::FromPredicate([Member = Member, CompVar, ComparativeFunc](const ClassType& Object) { return static_cast<bool>(ComparativeFunc(Object.*Member, CompVar)); });
+        }
+
+        template <typename ComparisonVariable>
+        Query<ClassType> operator==(const ComparisonVariable& CompVar) const {
+            return Query<ClassType>::FromPredicate([Member = Member, CompVar](const ClassType& Object) { return Object.*Member == CompVar; });
+        }
+
+        template <typename ComparisonVariable>
+        Query<ClassType> operator!=(const ComparisonVariable& CompVar) const {
+            return Query<ClassType>::FromPredicate([Member = Member, CompVar](const ClassType& Object) { return Object.*Member != CompVar; });
+        }
+
+        template <typename ComparisonVariable>
+        Query<ClassType> operator<(const ComparisonVariable& CompVar) const {
+            return Query<ClassType>::FromPredicate([Member = Member, CompVar](const ClassType& Object) { return Object.*Member < CompVar; });
+        }
+
+        template <typename ComparisonVariable>
+        Query<ClassType> operator<=(const ComparisonVariable& CompVar) const {
+            return Query<ClassType>::FromPredicate([Member = Member, CompVar](const ClassType& Object) { return Object.*Member <= CompVar; });
+        }
+
+        template <typename ComparisonVariable>
+        Query<ClassType> operator>(const ComparisonVariable& CompVar) const {
+            return Query<ClassType>::FromPredicate([Member = Member, CompVar](const ClassType& Object) { return Object.*Member > CompVar; });
+        }
+
+        template <typename ComparisonVariable>
+        Query<ClassType> operator>=(const ComparisonVariable& CompVar) const {
+            return Query<ClassType>::FromPredicate([Member = Member, CompVar](const ClassType& Object) { return Object.*Member >= CompVar; });
+        }
+
+    };
+
+    template <typename ClassType, typename MemberType>
+    requires HasAccessibleMember<ClassType, MemberType>
+    FieldReference<ClassType, MemberType> Field(MemberType ClassType::*Member) {
+        return FieldReference<ClassType, MemberType>{Member};
+    }
+
+    /**
+     * @brief Creates a vector of ClassType objects that satisfy Condition, evaluating every term of Condition in a single pass.
+     *
+     * @tparam ClassType The class Condition is evaluated on.
+     * @param ObjectVector A constant reference to a vector of type ClassType.
+     * @param Condition A Query built from Field comparisons. It is evaluated with its terms ordered by measured selectivity and cost, see Query::Plan.
+     * @return A vector of type ClassType containing the objects Condition evaluates true for.
+     */
+    template<typename ClassType>
+    std::vector<ClassType> Where(const std::vector<ClassType>& ObjectVector, const Query<ClassType>& Condition) {
+
+        Query<ClassType> Plan = Condition.Plan(ObjectVector);
+
+        std::vector<ClassType> ReturnVector;
+        ReturnVector.reserve(ObjectVector.size());
+
+        for (const ClassType& CurrentElement : ObjectVector) {
+
+            if (Plan(CurrentElement)) {
+                ReturnVector.emplace_back(CurrentElement);
+            }
+
+        }
+
+        Condition.Record(ObjectVector.size(), ReturnVector.size());
+
+        return ReturnVector;
+
+    }
+
+    /**
+     * @brief Edits a vector of ClassType objects to include only objects that satisfy Condition.
+     *
+     * @return The number of elements removed from ObjectVector.
+     */
+    template<typename ClassType>
+    size_t Where_p(std::vector<ClassType>& ObjectVector, const Query<ClassType>& Condition) {
+
+        Query<ClassType> Plan = Condition.Plan(ObjectVector);
+
+        std::vector<ClassType> ReturnVector;
+        ReturnVector.reserve(ObjectVector.size());
+
+        size_t ElementsRemoved = 0;
+
+        for (ClassType& CurrentElement : ObjectVector) {
+
+            if (Plan(CurrentElement)) {
+                ReturnVector.emplace_back(std::move(CurrentElement));
+            } else {
+                ElementsRemoved++;
+            }
+
+        }
+
+        Condition.Record(ObjectVector.size(), ReturnVector.size());
+
+        ObjectVector = std::move(ReturnVector);
+
+        return ElementsRemoved;
+
+    }
+
+/*
+==================================================================================================================================================================================
+INDEXES
+
+    Structures that answer repeated member lookups without scanning every object
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief A secondary index over one member of a vector of objects, answering equality and range queries by binary search.
+     *
+     * @tparam ClassType The class of the indexed vector's elements, must have MemberType as an accessible member (not private).
+     * @tparam MemberType The type of the indexed member, must be totally ordered.
+     * @note Keys and positions are kept in two parallel arrays sorted by key (ties by position), so each query is two binary searches over
+     *       a contiguous key array, and returns a view of the matching positions without allocating.
+     * @warning The index is a snapshot. Changes to the indexed vector are not seen until Rebuild is called.
+     */
+    template <typename ClassType, typename MemberType>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::totally_ordered<MemberType>
+    class SortedIndex {
+
+        private:
+
+        const std::vector<ClassType>* ObjectVectorPtr;
+        MemberType ClassType::*MemberTypePtr;
+
+        std::vector<MemberType> Keys;
+        std::vector<size_t> Positions;
+
+        std::span<const size_t> Slice(size_t Begin, size_t End) const {
+            return std::span<const size_t>(Positions.data() + Begin, End - Begin);
+        }
+
+        size_t LowerBound(const MemberType& Key) const {
+            return std::lower_bound(Keys.begin(), Keys.end(), Key) - Keys.begin();
+        }
+
+        size_t UpperBound(const MemberType& Key) const {
+            return std::upper_bound(Keys.begin(), Keys.end(), Key) - Keys.begin();
+        }
+
+        size_t EntryBound(const MemberType& Key, size_t Position) const {
+
+            size_t Slot = LowerBound(Key);
+
+            while (Slot < Keys.size() && Keys[Slot] == Key && Positions[Slot] < Position) {
+                Slot++;
+            }
+
+            return Slot;
+
+        }
+
+        public:
+
+        SortedIndex(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member)
+
+        :   ObjectVectorPtr(&ObjectVector),
+            MemberTypePtr(Member)
+
+        {
+            Rebuild();
+        }
+
+        /**
+         * @brief Re-reads every key from the indexed vector and sorts them.
+         */
+        void Rebuild() {
+
+            const std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+            std::vector<std::pair<MemberType, size_t>> Entries;
+            Entries.reserve(ObjectVector.size());
+
+            for (size_t i = 0; i < ObjectVector.size(); i++) {
+                Entries.emplace_back(ObjectVector[i].*MemberTypePtr, i);
+            }
+
+            std::sort(Entries.begin(), Entries.end());
+
+            Keys.clear();
+            Positions.clear();
+            Keys.reserve(Entries.size());
+            Positions.reserve(Entries.size());
+
+            for (auto& [Key, Position] : Entries) {
+                Keys.emplace_back(std::move(Key));
+                Positions.emplace_back(Position);
+            }
+
+        }
+
+        size_t Size() const {
+            return Keys.size();
+        }
+
+        /**
+         * @brief Positions of objects whose member equals Key, in ascending order.
+         */
+        std::span<const size_t> Equal(const MemberType& Key) const {
+            return Slice(LowerBound(Key), UpperBound(Key));
+        }
+
+        /**
+         * @brief Positions of objects whose member is less than Key, ordered by key.
+         */
+        std::span<const size_t> Less(const MemberType& Key) const {
+            return Slice(0, LowerBound(Key));
+        }
+
+        std::span<const size_t> LessEqual(const MemberType& Key) const {
+            return Slice(0, UpperBound(Key));
+        }
+
+        /**
+         * @brief Positions of objects whose member is greater than Key, ordered by key.
+         */
+        std::span<const size_t> Greater(const MemberType& Key) const {
+            return Slice(UpperBound(Key), Keys.size());
+        }
+
+        std::span<const size_t> GreaterEqual(const MemberType& Key) const {
+            return Slice(LowerBound(Key), Keys.size());
+        }
+
+        /**
+         * @brief Positions of objects whose member is within [Lower, Upper], inclusive of the bounds like SLN::InRange.
+         */
+        std::span<const size_t> InRange(const MemberType& Lower, const MemberType& Upper) const {
+
+            if (Upper < Lower) {
+                return {};
+            }
+
+            return Slice(LowerBound(Lower), UpperBound(Upper));
+
+        }
+
+        /**
+         * @brief Positions of objects whose member is within (Lower, Upper), exclusive of the bounds like SLN::InRangeExclusive.
+         */
+        std::span<const size_t> InRangeExclusive(const MemberType& Lower, const MemberType& Upper) const {
+
+            if (!(Lower < Upper)) {
+                return {};
+            }
+
+            return Slice(UpperBound(Lower), std::max(UpperBound(Lower), LowerBound(Upper)));
+
+        }
+
+        /**
+         * @brief Adds an entry mapping Key to Position, e.g. after an object is appended to the indexed vector. Costs O(n) to shift later entries.
+         */
+        void Insert(const MemberType& Key, size_t Position) {
+
+            size_t Slot = EntryBound(Key, Position);
+            Keys.insert(Keys.begin() + Slot, Key);
+            Positions.insert(Positions.begin() + Slot, Position);
+
+        }
+
+        /**
+         * @brief Removes the entry mapping Key to Position.
+         *
+         * @return True if the entry existed.
+         */
+        bool Erase(const MemberType& Key, size_t Position) {
+
+            size_t Slot = EntryBound(Key, Position);
+
+            if (Slot == Keys.size() || !(Keys[Slot] == Key) || Positions[Slot] != Position) {
+                return false;
+            }
+
+            Keys.erase(Keys.begin() + Slot);
+            Positions.erase(Positions.begin() + Slot);
+            return true;
+
+        }
+
+        /**
+         * @brief Re-reads the keys of the objects at ChangedPositions, whose keys were previously OldKeys.
+         *
+         * @note A few changes are applied individually. Larger batches remove every changed entry in one compaction pass, sort the new entries,
+         *       and merge them back in, costing O(n + k log k) rather than a full O(n log n) rebuild.
+         */
+        void UpdateKeys(std::span<const size_t> ChangedPositions, std::span<const MemberType> OldKeys) {
+
+            const std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+            if (ChangedPositions.size() <= 16) {
+
+                for (size_t i = 0; i < ChangedPositions.size(); i++) {
+                    Erase(OldKeys[i], ChangedPositions[i]);
+                    Insert(ObjectVector[ChangedPositions[i]].*MemberTypePtr, ChangedPositions[i]);
+                }
+
+                return;
+
+            }
+
+            std::vector<unsigned char> Changed(ObjectVector.size(), 0);
+
+            std::vector<std::pair<MemberType, size_t>> NewEntries;
+            NewEntries.reserve(ChangedPositions.size());
+
+            for (size_t Position : ChangedPositions) {
+                Changed[Position] = 1;
+                NewEntries.emplace_back(ObjectVector[Position].*MemberTypePtr, Position);
+            }
+
+            std::sort(NewEntries.begin(), NewEntries.end());
+
+            std::vector<MemberType> MergedKeys;
+            std::vector<size_t> MergedPositions;
+            MergedKeys.reserve(Keys.size());
+            MergedPositions.reserve(Positions.size());
+
+            size_t New = 0;
+
+            for (size_t i = 0; i < Keys.size(); i++) {
+
+                if (Positions[i] < Changed.size() && Changed[Positions[i]]) {
+                    continue;
+                }
+
+                while (New < NewEntries.size() && std::tie(NewEntries[New].first, NewEntries[New].second) < std::tie(Keys[i], Positions[i])) {
+                    MergedKeys.emplace_back(std::move(NewEntries[New].first));
+                    MergedPositions.emplace_back(NewEntries[New].second);
+                    New++;
+                }
+
+                MergedKeys.emplace_back(std::move(Keys[i]));
+                MergedPositions.emplace_back(Positions[i]);
+
+            }
+
+            for (; New < NewEntries.size(); New++) {
+                MergedKeys.emplace_back(std::move(NewEntries[New].first));
+                MergedPositions.emplace_back(NewEntries[New].second);
+            }
+
+            Keys = std::move(MergedKeys);
+            Positions = std::move(MergedPositions);
+
+        }
+
+        /**
+         * @brief Moves every entry from position p to NewPositions[p], dropping entries where NewPositions[p] is SIZE_MAX.
+         *
+         * @note NewPositions must preserve the relative order of surviving objects (as compacting filters do), so the entries stay sorted.
+         */
+        void Remap(const std::vector<size_t>& NewPositions) {
+
+            size_t Write = 0;
+
+            for (size_t Read = 0; Read < Keys.size(); Read++) {
+
+                size_t NewPosition = NewPositions[Positions[Read]];
+
+                if (NewPosition == SIZE_MAX) {
+                    continue;
+                }
+
+                if (Write != Read) Keys[Write] = std::move(Keys[Read]);
+                Positions[Write] = NewPosition;
+                Write++;
+
+            }
+
+            Keys.resize(Write);
+            Positions.resize(Write);
+
+        }
+
+        /**
+         * @brief Resolves positions returned by a query to references into the indexed vector.
+         */
+        std::vector<std::reference_wrapper<const ClassType>> Objects(std::span<const size_t> QueryPositions) const {
+
+            std::vector<std::reference_wrapper<const ClassType>> ReturnVector;
+            ReturnVector.reserve(QueryPositions.size());
+
+            for (size_t Position : QueryPositions) {
+                ReturnVector.emplace_back((*ObjectVectorPtr)[Position]);
+            }
+
+            return ReturnVector;
+
+        }
+
+    };
+
+    /**
+     * @brief A secondary index over one member of a vector of objects, answering equality lookups with O(1) expected probes.
+     *
+     * @tparam ClassType The class of the indexed vector's elements, must have MemberType as an accessible member (not private).
+     * @tparam MemberType The type of the indexed member, must be hashable with std::hash and equality comparable.
+     * @note The table is a single flat array of slots using linear probing, kept at most half full. Each slot holds one (key, position) entry,
+     *       so several objects may share a key. Slots store the full hash and a copy of the key, so probes never touch the indexed objects.
+     * @note Rebuild hashes every key in parallel, then places entries in order of their home slot, which fills the table in one linear pass
+     *       instead of probing at random. Insert and Erase keep the index in sync with individual changes without a rebuild.
+     */
+    template <typename ClassType, typename MemberType>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             EqualityCompatible<MemberType> &&
+             requires(const MemberType& Key) { { std::hash<MemberType>{}(Key) } -> std::convertible_to<size_t>; }
+    class HashIndex {
+
+        public:
+
+        static constexpr size_t NotFound = SIZE_MAX;
+
+        private:
+
+        static constexpr size_t EmptySlot = SIZE_MAX;
+
+        const std::vector<ClassType>* ObjectVectorPtr;
+        MemberType ClassType::*MemberTypePtr;
+
+        std::vector<uint64_t> SlotHashes;
+        std::vector<size_t> SlotPositions;
+        std::vector<MemberType> SlotKeys;
+        size_t Mask = 0;
+        size_t Count = 0;
+
+        static uint64_t HashKey(const MemberType& Key) {
+
+            // std::hash is the identity for integers on common implementations, so the bits are mixed before use.
+            uint64_t Hash = static_cast<uint64_t>(std::hash<MemberType>{}(Key));
+            Hash ^= Hash >> 33;
+            Hash *= 0xff51afd7ed558ccdULL;
+            Hash ^= Hash >> 33;
+            Hash *= 0xc4ceb9fe1a85ec53ULL;
+            Hash ^= Hash >> 33;
+            return Hash;
+
+        }
+
+        static size_t CapacityFor(size_t Entries) {
+            return std::bit_ceil(std::max<size_t>(Entries * 2, 16));
+        }
+
+        void Allocate(size_t Capacity) {
+            SlotHashes.assign(Capacity, 0);
+            SlotPositions.assign(Capacity, EmptySlot);
+            SlotKeys.assign(Capacity, MemberType{});
+            Mask = Capacity - 1;
+        }
+
+        void Place(size_t Slot, uint64_t Hash, size_t Position, const MemberType& Key) {
+            SlotHashes[Slot] = Hash;
+            SlotPositions[Slot] = Position;
+            SlotKeys[Slot] = Key;
+        }
+
+        void ProbeInsert(uint64_t Hash, size_t Position, const MemberType& Key) {
+
+            size_t Slot = Hash & Mask;
+
+            while (SlotPositions[Slot] != EmptySlot) {
+                Slot = (Slot + 1) & Mask;
+            }
+
+            Place(Slot, Hash, Position, Key);
+
+        }
+
+        void Grow() {
+
+            std::vector<uint64_t> OldHashes = std::move(SlotHashes);
+            std::vector<size_t> OldPositions = std::move(SlotPositions);
+            std::vector<MemberType> OldKeys = std::move(SlotKeys);
+
+            Allocate(OldHashes.size() * 2);
+
+            for (size_t i = 0; i < OldHashes.size(); i++) {
+                if (OldPositions[i] != EmptySlot) {
+                    ProbeInsert(OldHashes[i], OldPositions[i], OldKeys[i]);
+                }
+            }
+
+        }
+
+        public:
+
+        HashIndex(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member)
+
+        :   ObjectVectorPtr(&ObjectVector),
+            MemberTypePtr(Member)
+
+        {
+            Rebuild();
+        }
+
+        /**
+         * @brief Re-reads every key from the indexed vector and rebuilds the table.
+         */
+        void Rebuild() {
+
+            const std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+            Count = ObjectVector.size();
+            Allocate(CapacityFor(Count));
+
+            std::vector<uint64_t> Hashes(Count);
+
+            SLP::ParallelFor(Count, [&](size_t Begin, size_t End) {
+                for (size_t i = Begin; i < End; i++) {
+                    Hashes[i] = HashKey(ObjectVector[i].*MemberTypePtr);
+                }
+            }, 4096);
+
+            // Counting sort of positions by home slot.
+            std::vector<size_t> Offsets(SlotHashes.size() + 1, 0);
+
+            for (uint64_t Hash : Hashes) {
+                Offsets[(Hash & Mask) + 1]++;
+            }
+
+            for (size_t i = 1; i < Offsets.size(); i++) {
+                Offsets[i] += Offsets[i - 1];
+            }
+
+            std::vector<size_t> Order(Count);
+
+            for (size_t i = 0; i < Count; i++) {
+                Order[Offsets[Hashes[i] & Mask]++] = i;
+            }
+
+            // In home slot order, each entry lands on its home slot or just after the previous entry, which is exactly where probing would put it.
+            std::vector<size_t> Overflow;
+            size_t NextFree = 0;
+
+            for (size_t Position : Order) {
+
+                size_t Slot = std::max<size_t>(Hashes[Position] & Mask, NextFree);
+
+                if (Slot > Mask) {
+                    Overflow.push_back(Position);
+                    continue;
+                }
+
+                Place(Slot, Hashes[Position], Position, ObjectVector[Position].*MemberTypePtr);
+                NextFree = Slot + 1;
+
+            }
+
+            for (size_t Position : Overflow) {
+                ProbeInsert(Hashes[Position], Position, ObjectVector[Position].*MemberTypePtr);
+            }
+
+        }
+
+        size_t Size() const {
+            return Count;
+        }
+
+        /**
+         * @brief Returns the position of an object whose member equals Key, or NotFound.
+         */
+        size_t Find(const MemberType& Key) const {
+
+            uint64_t Hash = HashKey(Key);
+
+            for (size_t Slot = Hash & Mask; SlotPositions[Slot] != EmptySlot; Slot = (Slot + 1) & Mask) {
+                if (SlotHashes[Slot] == Hash && SlotKeys[Slot] == Key) {
+                    return SlotPositions[Slot];
+                }
+            }
+
+            return NotFound;
+
+        }
+
+        /**
+         * @brief Calls Func(Position) for every object whose member equals Key.
+         */
+        template <typename Function>
+        void ForEachEqual(const MemberType& Key, Function Func) const {
+
+            uint64_t Hash = HashKey(Key);
+
+            for (size_t Slot = Hash & Mask; SlotPositions[Slot] != EmptySlot; Slot = (Slot + 1) & Mask) {
+                if (SlotHashes[Slot] == Hash && SlotKeys[Slot] == Key) {
+                    Func(SlotPositions[Slot]);
+                }
+            }
+
+        }
+
+        /**
+         * @brief Positions of every object whose member equals Key, in ascending order.
+         */
+        std::vector<size_t> Equal(const MemberType& Key) const {
+
+            std::vector<size_t> ReturnVector;
+            ForEachEqual(Key, [&](size_t Position) { ReturnVector.push_back(Position); });
+            std::sort(ReturnVector.begin(), ReturnVector.end());
+            return ReturnVector;
+
+        }
+
+        size_t CountEqual(const MemberType& Key) const {
+
+            size_t Matches = 0;
+            ForEachEqual(Key, [&](size_t) { Matches++; });
+            return Matches;
+
+        }
+
+        /**
+         * @brief Adds an entry mapping Key to Position, e.g. after an object is appended to the indexed vector.
+         */
+        void Insert(const MemberType& Key, size_t Position) {
+
+            if ((Count + 1) * 2 > SlotHashes.size()) {
+                Grow();
+            }
+
+            ProbeInsert(HashKey(Key), Position, Key);
+            Count++;
+
+        }
+
+        /**
+         * @brief Removes the entry mapping Key to Position.
+         *
+         * @return True if the entry existed.
+         * @note Later entries in the probe run are shifted back, so the table never accumulates tombstones.
+         */
+        bool Erase(const MemberType& Key, size_t Position) {
+
+            uint64_t Hash = HashKey(Key);
+            size_t Slot = Hash & Mask;
+
+            while (SlotPositions[Slot] != EmptySlot && !(SlotPositions[Slot] == Position && SlotHashes[Slot] == Hash && SlotKeys[Slot] == Key)) {
+                Slot = (Slot + 1) & Mask;
+            }
+
+            if (SlotPositions[Slot] == EmptySlot) {
+                return false;
+            }
+
+            size_t Hole = Slot;
+
+            for (size_t Next = (Hole + 1) & Mask; SlotPositions[Next] != EmptySlot; Next = (Next + 1) & Mask) {
+
+                size_t Home = SlotHashes[Next] & Mask;
+
+                // Move the entry at Next into the hole unless its home lies cyclically within (Hole, Next].
+                bool HomeBetween = (Hole <= Next) ? (Home > Hole && Home <= Next) : (Home > Hole || Home <= Next);
+
+                if (!HomeBetween) {
+                    Place(Hole, SlotHashes[Next], SlotPositions[Next], SlotKeys[Next]);
+                    Hole = Next;
+                }
+
+            }
+
+            SlotPositions[Hole] = EmptySlot;
+            SlotKeys[Hole] = MemberType{};
+            Count--;
+
+            return true;
+
+        }
+
+        /**
+         * @brief Re-reads the keys of the objects at ChangedPositions, whose keys were previously OldKeys.
+         */
+        void UpdateKeys(std::span<const size_t> ChangedPositions, std::span<const MemberType> OldKeys) {
+
+            const std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+            for (size_t i = 0; i < ChangedPositions.size(); i++) {
+                Erase(OldKeys[i], ChangedPositions[i]);
+                Insert(ObjectVector[ChangedPositions[i]].*MemberTypePtr, ChangedPositions[i]);
+            }
+
+        }
+
+        /**
+         * @brief Moves every entry from position p to NewPositions[p], dropping entries where NewPositions[p] is SIZE_MAX.
+         *
+         * @warning Must be called before the indexed vector is compacted, as the keys of dropped entries are read from it.
+         */
+        void Remap(const std::vector<size_t>& NewPositions) {
+
+            const std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+            for (size_t Position = 0; Position < NewPositions.size(); Position++) {
+                if (NewPositions[Position] == SIZE_MAX) {
+                    Erase(ObjectVector[Position].*MemberTypePtr, Position);
+                }
+            }
+
+            for (size_t& Position : SlotPositions) {
+                if (Position != EmptySlot) {
+                    Position = NewPositions[Position];
+                }
+            }
+
+        }
+
+        /**
+         * @brief Resolves positions to references into the indexed vector.
+         */
+        std::vector<std::reference_wrapper<const ClassType>> Objects(std::span<const size_t> QueryPositions) const {
+
+            std::vector<std::reference_wrapper<const ClassType>> ReturnVector;
+            ReturnVector.reserve(QueryPositions.size());
+
+            for (size_t Position : QueryPositions) {
+                ReturnVector.emplace_back((*ObjectVectorPtr)[Position]);
+            }
+
+            return ReturnVector;
+
+        }
+
+    };
+
+    /**
+     * @brief Owns a vector of objects together with any number of SortedIndex and HashIndex instances over its members, and keeps them in sync.
+     *
+     * @tparam ClassType The class of the owned vector's elements.
+     * @note Mutations made through IndexedVector (or the SLO overloads below that take one) only update indexes on the members they touch,
+     *       and only for the objects whose key actually changed. Filters remap positions in place instead of rebuilding.
+     * @warning Indexes refer to the owned vector, so an IndexedVector can be neither copied nor moved. Mutating objects through references
+     *          obtained elsewhere bypasses the indexes, call RebuildIndexes afterwards.
+     */
+    template <typename ClassType>
+    class IndexedVector {
+
+        private:
+
+        struct IndexHandle {
+
+            virtual ~IndexHandle() = default;
+
+            virtual bool IsOn(const std::type_index& MemberPointerType, const void* MemberPointer) const = 0;
+
+            // Records the keys at Positions before a mutation, then after it, updates the index for every key that changed.
+            virtual void Capture(std::span<const size_t> Positions) = 0;
+            virtual void CaptureAll() = 0;
+            virtual void CommitCaptured() = 0;
+
+            virtual void Remap(const std::vector<size_t>& NewPositions) = 0;
+            virtual void Inserted(size_t Position) = 0;
+            virtual void Rebuild() = 0;
+
+        };
+
+        template <typename IndexType, typename MemberType>
+        struct IndexAdapter : IndexHandle {
+
+            IndexType Index;
+            const std::vector<ClassType>* ObjectVectorPtr;
+            MemberType ClassType::*MemberTypePtr;
+
+            std::vector<size_t> CapturedPositions;
+            std::vector<MemberType> CapturedKeys;
+
+            IndexAdapter(const std::vector<ClassType>& ObjectVector, MemberType ClassType::*Member)
+
+            :   Index(ObjectVector, Member),
+                ObjectVectorPtr(&ObjectVector),
+                MemberTypePtr(Member)
+
+            {
+
+            }
+
+            bool IsOn(const std::type_index& MemberPointerType, const void* MemberPointer) const override {
+                return MemberPointerType == std::type_index(typeid(MemberTypePtr)) &&
+                       *static_cast<MemberType ClassType::* const*>(MemberPointer) == MemberTypePtr;
+            }
+
+            void Capture(std::span<const size_t> Positions) override {
+
+                for (size_t Position : Positions) {
+                    CapturedPositions.push_back(Position);
+                    CapturedKeys.push_back((*ObjectVectorPtr)[Position].*MemberTypePtr);
+                }
+
+            }
+
+            void CaptureAll() override {
+
+                const std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+                CapturedPositions.resize(ObjectVector.size());
+                CapturedKeys.clear();
+                CapturedKeys.reserve(ObjectVector.size());
+
+                for (size_t i = 0; i < ObjectVector.size(); i++) {
+                    CapturedPositions[i] = i;
+                    CapturedKeys.push_back(ObjectVector[i].*MemberTypePtr);
+                }
+
+            }
+
+            void CommitCaptured() override {
+
+                const std::vector<ClassType>& ObjectVector = *ObjectVectorPtr;
+
+                size_t Changed = 0;
+
+                for (size_t i = 0; i < CapturedPositions.size(); i++) {
+
+                    if (!(ObjectVector[CapturedPositions[i]].*MemberTypePtr == CapturedKeys[i])) {
+                        CapturedPositions[Changed] = CapturedPositions[i];
+                        CapturedKeys[Changed] = std::move(CapturedKeys[i]);
+                        Changed++;
+                    }
+
+                }
+
+                Index.UpdateKeys(std::span<const size_t>(CapturedPositions.data(), Changed), std::span<const MemberType>(CapturedKeys.data(), Changed));
+
+                CapturedPositions.clear();
+                CapturedKeys.clear();
+
+            }
+
+            void Remap(const std::vector<size_t>& NewPositions) override {
+                Index.Remap(NewPositions);
+            }
+
+            void Inserted(size_t Position) override {
+                Index.Insert((*ObjectVectorPtr)[Position].*MemberTypePtr, Position);
+            }
+
+            void Rebuild() override {
+                Index.Rebuild();
+            }
+
+        };
+
+        std::vector<ClassType> Objects;
+        std::vector<std::unique_ptr<IndexHandle>> Indexes;
+
+        template <typename MemberType>
+        std::vector<IndexHandle*> IndexesOn(MemberType ClassType::*Member) const {
+
+            std::vector<IndexHandle*> Matches;
+
+            for (const std::unique_ptr<IndexHandle>& Handle : Indexes) {
+                if (Handle->IsOn(std::type_index(typeid(Member)), &Member)) {
+                    Matches.push_back(Handle.get());
+                }
+            }
+
+            return Matches;
+
+        }
+
+        template <typename MemberType, typename Function>
+        void MutateMember(MemberType ClassType::*Member, Function Mutation) {
+
+            std::vector<IndexHandle*> Affected = IndexesOn(Member);
+
+            for (IndexHandle* Handle : Affected) {
+                Handle->CaptureAll();
+            }
+
+            Mutation();
+
+            for (IndexHandle* Handle : Affected) {
+                Handle->CommitCaptured();
+            }
+
+        }
+
+        /**
+         * @brief The position of Linked's parent in Objects, checked before any index captures it.
+         *
+         * @throws std::out_of_range If the parent is not an element of Objects, e.g. the LinkedMember predates a PushBack that reallocated.
+         * @throws std::invalid_argument If Linked is linked to a different member than Member, whose indexes would otherwise go stale.
+         */
+        template <typename MemberType>
+        size_t PositionOf(LinkedMember<ClassType, MemberType>& Linked, MemberType ClassType::*Member) const {
+
+            if (Linked.GetMember() != Member) {
+                throw std::invalid_argument("IndexedVector::Commit: the LinkedMember is linked to a different member");
+            }
+
+            const ClassType* Parent = Linked.GetClass();
+            const ClassType* Begin = Objects.data();
+            const ClassType* End = Begin + Objects.size();
+
+            // std::less gives a total order over unrelated pointers, where the built in comparisons do not.
+            if (std::less<const ClassType*>()(Parent, Begin) || !std::less<const ClassType*>()(Parent, End)) {
+                throw std::out_of_range("IndexedVector::Commit: the LinkedMember's parent is not in the vector");
+            }
+
+            return static_cast<size_t>(Parent - Begin);
+
+        }
+
+        template <typename MemberType, typename KeepFunction>
+        size_t RetainIf(MemberType ClassType::*Member, KeepFunction KeepFunc) {
+
+            std::vector<size_t> NewPositions(Objects.size());
+            size_t Kept = 0;
+
+            for (size_t i = 0; i < Objects.size(); i++) {
+                NewPositions[i] = KeepFunc(Objects[i].*Member) ? Kept++ : SIZE_MAX;
+            }
+
+            if (Kept == Objects.size()) {
+                return 0;
+            }
+
+            for (const std::unique_ptr<IndexHandle>& Handle : Indexes) {
+                Handle->Remap(NewPositions);
+            }
+
+            for (size_t i = 0; i < Objects.size(); i++) {
+                if (NewPositions[i] != SIZE_MAX && NewPositions[i] != i) {
+                    Objects[NewPositions[i]] = std::move(Objects[i]);
+                }
+            }
+
+            size_t ElementsRemoved = Objects.size() - Kept;
+            Objects.erase(Objects.begin() + Kept, Objects.end());
+
+            return ElementsRemoved;
+
+        }
+
+        public:
+
+        IndexedVector() = default;
+
+        explicit IndexedVector(std::vector<ClassType> InitialObjects) : Objects(std::move(InitialObjects)) {}
+
+        IndexedVector(const IndexedVector&) = delete;
+        IndexedVector& operator=(const IndexedVector&) = delete;
+
+        const std::vector<ClassType>& Vector() const {
+            return Objects;
+        }
+
+        size_t Size() const {
+            return Objects.size();
+        }
+
+        const ClassType& operator[](size_t Index) const {
+            return Objects[Index];
+        }
+
+        template <typename MemberType>
+        SortedIndex<ClassType, MemberType>& AddSortedIndex(MemberType ClassType::*Member) {
+
+            auto Handle = std::make_unique<IndexAdapter<SortedIndex<ClassType, MemberType>, MemberType>>(Objects, Member);
+            SortedIndex<ClassType, MemberType>& Index = Handle->Index;
+            Indexes.push_back(std::move(Handle));
+            return Index;
+
+        }
+
+        template <typename MemberType>
+        HashIndex<ClassType, MemberType>& AddHashIndex(MemberType ClassType::*Member) {
+
+            auto Handle = std::make_unique<IndexAdapter<HashIndex<ClassType, MemberType>, MemberType>>(Objects, Member);
+            HashIndex<ClassType, MemberType>& Index = Handle->Index;
+            Indexes.push_back(std::move(Handle));
+            return Index;
+
+        }
+
+        void RebuildIndexes() {
+            for (const std::unique_ptr<IndexHandle>& Handle : Indexes) {
+                Handle->Rebuild();
+            }
+        }
+
+        /**
+         * @warning May reallocate, invalidating LinkedMembers from ExtractLinked. Committing one invalidated this way throws std::out_of_range.
+         */
+        void PushBack(const ClassType& Object) {
+
+            Objects.push_back(Object);
+
+            for (const std::unique_ptr<IndexHandle>& Handle : Indexes) {
+                Handle->Inserted(Objects.size() - 1);
+            }
+
+        }
+
+        /**
+         * @brief Calls ModifyFunc(Object) on the object at Position, then updates every index whose key it changed.
+         */
+        template <typename Function>
+        requires std::invocable<Function, ClassType&>
+        void Modify(size_t Position, Function ModifyFunc) {
+
+            for (const std::unique_ptr<IndexHandle>& Handle : Indexes) {
+                Handle->Capture(std::span<const size_t>(&Position, 1));
+            }
+
+            ModifyFunc(Objects[Position]);
+
+            for (const std::unique_ptr<IndexHandle>& Handle : Indexes) {
+                Handle->CommitCaptured();
+            }
+
+        }
+
+        template <typename MemberType, typename OperationVariable, typename Operation>
+        void Operate_p(MemberType ClassType::*Member, const OperationVariable& OperationVar, Operation OperativeFunc) {
+            MutateMember(Member, [&] { SLO::Operate_p(Objects, Member, OperationVar, OperativeFunc); });
+        }
+
+        template <typename MemberType, typename Operation>
+        void Operate_p(MemberType ClassType::*Member, Operation OperativeFunc) {
+            MutateMember(Member, [&] { SLO::Operate_p(Objects, Member, OperativeFunc); });
+        }
+
+        template <typename MemberType, typename ComparisonVariable>
+        size_t EqualityInclusion_p(MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+            return RetainIf(Member, [&](const MemberType& Value) { return Value == CompVar; });
+        }
+
+        template <typename MemberType, typename ComparisonVariable>
+        size_t EqualityExclusion_p(MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+            return RetainIf(Member, [&](const MemberType& Value) { return Value != CompVar; });
+        }
+
+        template <typename MemberType, typename Predicate>
+        size_t ConditionalInclusion_p(MemberType ClassType::*Member, Predicate ConditionalFunc) {
+            return RetainIf(Member, [&](const MemberType& Value) { return static_cast<bool>(ConditionalFunc(Value)); });
+        }
+
+        template <typename MemberType, typename Predicate>
+        size_t ConditionalExclusion_p(MemberType ClassType::*Member, Predicate ConditionalFunc) {
+            return RetainIf(Member, [&](const MemberType& Value) { return !ConditionalFunc(Value); });
+        }
+
+        template <typename MemberType, typename ComparisonVariable, typename Comparative>
+        size_t ComparativeInclusion_p(MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+            return RetainIf(Member, [&](const MemberType& Value) { return static_cast<bool>(ComparativeFunc(Value, CompVar)); });
+        }
+
+        template <typename MemberType, typename ComparisonVariable, typename Comparative>
+        size_t ComparativeExclusion_p(MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+            return RetainIf(Member, [&](const MemberType& Value) { return !ComparativeFunc(Value, CompVar); });
+        }
+
+        /**
+         * @brief Creates LinkedMembers over the owned objects. Commit them through Commit below so the indexes see the change.
+         *
+         * @warning They refer to the objects in place, so they are invalidated by PushBack and by any filter that removes objects.
+         */
+        template <typename MemberType>
+        std::vector<LinkedMember<ClassType, MemberType>> ExtractLinked(MemberType ClassType::*Member) {
+            return SLO::ExtractLinked(Objects, Member);
+        }
+
+        /**
+         * @brief Commits LinkedMembers created by ExtractLinked, updating indexes on Member for each parent whose key changed.
+         *
+         * @throws std::out_of_range If a parent is no longer in the vector, std::invalid_argument if a LinkedMember is linked to a member other
+         *         than Member. Both are checked before anything is written.
+         * @note Several LinkedMembers may share a parent, in which case the last one wins as with LinkedMember::Commit. Each parent is
+         *       captured once, so the indexes see a single key change per parent.
+         */
+        template <typename MemberType>
+        void Commit(std::vector<LinkedMember<ClassType, MemberType>>& LinkedVector, MemberType ClassType::*Member) {
+
+            std::vector<IndexHandle*> Affected = IndexesOn(Member);
+
+            std::vector<size_t> Positions;
+            Positions.reserve(LinkedVector.size());
+
+            for (LinkedMember<ClassType, MemberType>& Linked : LinkedVector) {
+                Positions.push_back(PositionOf(Linked, Member));
+            }
+
+            std::sort(Positions.begin(), Positions.end());
+            Positions.erase(std::unique(Positions.begin(), Positions.end()), Positions.end());
+
+            for (IndexHandle* Handle : Affected) {
+                Handle->Capture(Positions);
+            }
+
+            for (LinkedMember<ClassType, MemberType>& Linked : LinkedVector) {
+                Linked.Commit();
+            }
+
+            for (IndexHandle* Handle : Affected) {
+                Handle->CommitCaptured();
+            }
+
+        }
+
+        template <typename MemberType>
+        void Commit(LinkedMember<ClassType, MemberType>& Linked, MemberType ClassType::*Member) {
+
+            std::vector<IndexHandle*> Affected = IndexesOn(Member);
+            size_t Position = PositionOf(Linked, Member);
+
+            for (IndexHandle* Handle : Affected) {
+                Handle->Capture(std::span<const size_t>(&Position, 1));
+            }
+
+            Linked.Commit();
+
+            for (IndexHandle* Handle : Affected) {
+                Handle->CommitCaptured();
+            }
+
+        }
+
+    };
+
+    template<typename ClassType, typename MemberType, typename OperationVariable, typename Operation>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Operation, const MemberType&, const OperationVariable&> &&
+             std::convertible_to<std::invoke_result_t<Operation, MemberType&, const OperationVariable&>, MemberType>
+    void Operate_p(IndexedVector<ClassType>& ObjectVector, MemberType ClassType::*Member, const OperationVariable& OperationVar, Operation OperativeFunc) {
+        ObjectVector.Operate_p(Member, OperationVar, OperativeFunc);
+    }
+
+    template<typename ClassType, typename MemberType, typename Operation>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Operation, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Operation, MemberType&>, MemberType>
+    void Operate_p(IndexedVector<ClassType>& ObjectVector, MemberType ClassType::*Member, Operation OperativeFunc) {
+        ObjectVector.Operate_p(Member, OperativeFunc);
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::equality_comparable_with<MemberType, ComparisonVariable>
+    size_t EqualityInclusion_p(IndexedVector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+        return ObjectVector.EqualityInclusion_p(Member, CompVar);
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::equality_comparable_with<MemberType, ComparisonVariable>
+    size_t EqualityExclusion_p(IndexedVector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar) {
+        return ObjectVector.EqualityExclusion_p(Member, CompVar);
+    }
+
+    template<typename ClassType, typename MemberType, typename Predicate>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Predicate, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+    size_t ConditionalInclusion_p(IndexedVector<ClassType>& ObjectVector, MemberType ClassType::*Member, Predicate ConditionalFunc) {
+        return ObjectVector.ConditionalInclusion_p(Member, ConditionalFunc);
+    }
+
+    template<typename ClassType, typename MemberType, typename Predicate>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Predicate, const MemberType&> &&
+             std::convertible_to<std::invoke_result_t<Predicate, const MemberType&>, bool>
+    size_t ConditionalExclusion_p(IndexedVector<ClassType>& ObjectVector, MemberType ClassType::*Member, Predicate ConditionalFunc) {
+        return ObjectVector.ConditionalExclusion_p(Member, ConditionalFunc);
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable, typename Comparative>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+    size_t ComparativeInclusion_p(IndexedVector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+        return ObjectVector.ComparativeInclusion_p(Member, CompVar, ComparativeFunc);
+    }
+
+    template<typename ClassType, typename MemberType, typename ComparisonVariable, typename Comparative>
+    requires HasAccessibleMember<ClassType, MemberType> &&
+             std::invocable<Comparative, const MemberType&, const ComparisonVariable&> &&
+             std::convertible_to<std::invoke_result_t<Comparative, const MemberType&, const ComparisonVariable&>, bool>
+    size_t ComparativeExclusion_p(IndexedVector<ClassType>& ObjectVector, MemberType ClassType::*Member, const ComparisonVariable& CompVar, Comparative ComparativeFunc) {
+        return ObjectVector.ComparativeExclusion_p(Member, CompVar, ComparativeFunc);
+    }
+
 /*
 ==================================================================================================================================================================================
 IOSTREAM FUNCTIONS
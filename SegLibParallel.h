@@ -0,0 +1,310 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#pragma once
+
+namespace SLP {
+
+/*
+==================================================================================================================================================================================
+THREAD POOL
+
+    A persistent work-stealing thread pool shared by SegLib's parallel functions.
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief A fixed size pool of worker threads, each owning a task queue. Idle workers steal from the front of other workers' queues.
+     *
+     * @note Tasks submitted from inside a worker are pushed to that worker's own queue, so nested parallel work stays local where possible.
+     */
+    class ThreadPool {
+
+        private:
+
+        struct WorkerQueue {
+            std::mutex Lock;
+            std::deque<std::function<void()>> Tasks;
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> Queues;
+        std::vector<std::thread> Workers;
+
+        std::mutex SleepLock;
+        std::condition_variable WakeCondition;
+
+        std::atomic<size_t> PendingTasks{0};
+        std::atomic<size_t> NextQueue{0};
+        bool Stopping = false;
+
+        inline static thread_local ThreadPool* CurrentPool = nullptr;
+        inline static thread_local size_t CurrentIndex = 0;
+
+        bool TryPop(size_t QueueIndex, std::function<void()>& Task) {
+
+            WorkerQueue& Queue = *Queues[QueueIndex];
+            std::lock_guard<std::mutex> Guard(Queue.Lock);
+
+            if (Queue.Tasks.empty()) {
+                return false;
+            }
+
+            Task = std::move(Queue.Tasks.back());
+            Queue.Tasks.pop_back();
+            return true;
+
+        }
+
+        bool TrySteal(size_t ThiefIndex, std::function<void()>& Task) {
+
+            for (size_t i = 1; i <= Queues.size(); i++) {
+
+                WorkerQueue& Queue = *Queues[(ThiefIndex + i) % Queues.size()];
+                std::lock_guard<std::mutex> Guard(Queue.Lock);
+
+                if (!Queue.Tasks.empty()) {
+                    Task = std::move(Queue.Tasks.front());
+                    Queue.Tasks.pop_front();
+                    return true;
+                }
+
+            }
+
+            return false;
+
+        }
+
+        void WorkerLoop(size_t Index) {
+
+            CurrentPool = this;
+            CurrentIndex = Index;
+
+            std::function<void()> Task;
+
+            while (true) {
+
+                if (TryPop(Index, Task) || TrySteal(Index, Task)) {
+                    PendingTasks.fetch_sub(1, std::memory_order_relaxed);
+                    Task();
+                    Task = nullptr;
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> Guard(SleepLock);
+                WakeCondition.wait(Guard, [this] { return Stopping || PendingTasks.load(std::memory_order_relaxed) > 0; });
+
+                if (Stopping && PendingTasks.load(std::memory_order_relaxed) == 0) {
+                    return;
+                }
+
+            }
+
+        }
+
+        public:
+
+        explicit ThreadPool(size_t ThreadCount) {
+
+            ThreadCount = std::max<size_t>(ThreadCount, 1);
+
+            Queues.reserve(ThreadCount);
+            for (size_t i = 0; i < ThreadCount; i++) {
+                Queues.emplace_back(std::make_unique<WorkerQueue>());
+            }
+
+            Workers.reserve(ThreadCount);
+            for (size_t i = 0; i < ThreadCount; i++) {
+                Workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+            }
+
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool() {
+
+            {
+                std::lock_guard<std::mutex> Guard(SleepLock);
+                Stopping = true;
+            }
+
+            WakeCondition.notify_all();
+
+            for (std::thread& Worker : Workers) {
+                Worker.join();
+            }
+
+        }
+
+        size_t Size() const {
+            return Workers.size();
+        }
+
+        /**
+         * @brief Queues a task for execution on the pool.
+         *
+         * @param Task Any callable taking no arguments. It must not throw.
+         */
+        void Submit(std::function<void()> Task) {
+
+            size_t QueueIndex = (CurrentPool == this) ? CurrentIndex : NextQueue.fetch_add(1, std::memory_order_relaxed) % Queues.size();
+
+            PendingTasks.fetch_add(1, std::memory_order_relaxed);
+
+            {
+                WorkerQueue& Queue = *Queues[QueueIndex];
+                std::lock_guard<std::mutex> Guard(Queue.Lock);
+                Queue.Tasks.emplace_back(std::move(Task));
+            }
+
+            {
+                std::lock_guard<std::mutex> Guard(SleepLock);
+            }
+
+            WakeCondition.notify_one();
+
+        }
+
+    };
+
+    /**
+     * @brief Returns the process-wide pool, created on first use with one worker less than the hardware concurrency (the calling thread makes up the difference).
+     */
+    inline ThreadPool& GetThreadPool() {
+
+        static ThreadPool Pool(std::max<unsigned int>(std::thread::hardware_concurrency(), 2) - 1);
+        return Pool;
+
+    }
+
+/*
+==================================================================================================================================================================================
+PARALLEL LOOPS
+
+    Functions that split index ranges across the thread pool.
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief Calls RangeFunc(Begin, End) over disjoint sub-ranges covering [0, Count), using the calling thread and the shared pool. Returns once every index has been processed.
+     *
+     * @tparam RangeFunction Any function taking two size_t arguments, Begin and End.
+     * @param Count The number of indices to process.
+     * @param RangeFunc The function invoked once per claimed sub-range. Sub-ranges may run concurrently.
+     * @param MinimumChunkSize The smallest sub-range that will be claimed, except for the final one.
+     * @throws Rethrows the first exception thrown by RangeFunc, on the calling thread, once every sub-range already claimed has finished.
+     *         Sub-ranges not yet claimed when it was thrown are skipped.
+     * @note Sub-ranges are claimed with guided scheduling: each claim takes the remaining count divided by twice the number of lanes, so chunks shrink
+     *       as the range drains and threads that hit cheap elements simply claim more. This keeps lanes busy when per-element cost is uneven.
+     */
+    template <typename RangeFunction>
+    void ParallelFor(size_t Count, RangeFunction RangeFunc, size_t MinimumChunkSize = 1) {
+
+        if (Count == 0) {
+            return;
+        }
+
+        MinimumChunkSize = std::max<size_t>(MinimumChunkSize, 1);
+
+        ThreadPool& Pool = GetThreadPool();
+
+        size_t MaximumChunks = (Count + MinimumChunkSize - 1) / MinimumChunkSize;
+        size_t Helpers = std::min(Pool.Size(), MaximumChunks - 1);
+
+        if (Helpers == 0) {
+            RangeFunc(size_t(0), Count);
+            return;
+        }
+
+        struct SharedState {
+            std::atomic<size_t> Next{0};
+            std::atomic<size_t> Completed{0};
+            size_t Count;
+            size_t MinimumChunkSize;
+            size_t Lanes;
+            RangeFunction* Func;
+
+            std::mutex ExceptionLock;
+            std::exception_ptr Exception;
+        };
+
+        std::shared_ptr<SharedState> State = std::make_shared<SharedState>();
+        State->Count = Count;
+        State->MinimumChunkSize = MinimumChunkSize;
+        State->Lanes = Helpers + 1;
+        State->Func = &RangeFunc;
+
+        // Tasks that start after the range has drained claim nothing and never touch Func, so the shared state is all they may outlive us with.
+        // A throwing sub-range drains the range by claiming everything left, so the caller still waits for every claimed sub-range before rethrowing.
+        auto Drain = [](SharedState& S) {
+
+            auto Complete = [&S](size_t Size) {
+                if (S.Completed.fetch_add(Size, std::memory_order_acq_rel) + Size == S.Count) {
+                    S.Completed.notify_all();
+                }
+            };
+
+            while (true) {
+
+                size_t Observed = S.Next.load(std::memory_order_relaxed);
+                size_t Begin;
+                size_t Size;
+
+                do {
+                    if (Observed >= S.Count) return;
+                    Size = std::max((S.Count - Observed) / (S.Lanes * 2), S.MinimumChunkSize);
+                    Size = std::min(Size, S.Count - Observed);
+                    Begin = Observed;
+                } while (!S.Next.compare_exchange_weak(Observed, Observed + Size, std::memory_order_relaxed));
+
+                try {
+                    (*S.Func)(Begin, Begin + Size);
+                } catch (...) {
+
+                    {
+                        std::lock_guard<std::mutex> Guard(S.ExceptionLock);
+                        if (!S.Exception) S.Exception = std::current_exception();
+                    }
+
+                    size_t Unclaimed = S.Count - std::min(S.Next.exchange(S.Count, std::memory_order_relaxed), S.Count);
+                    Complete(Size + Unclaimed);
+                    return;
+
+                }
+
+                Complete(Size);
+
+            }
+
+        };
+
+        for (size_t i = 0; i < Helpers; i++) {
+            Pool.Submit([State, Drain] { Drain(*State); });
+        }
+
+        Drain(*State);
+
+        size_t Done = State->Completed.load(std::memory_order_acquire);
+        while (Done < Count) {
+            State->Completed.wait(Done, std::memory_order_acquire);
+            Done = State->Completed.load(std::memory_order_acquire);
+        }
+
+        if (State->Exception) {
+            std::rethrow_exception(State->Exception);
+        }
+
+    }
+
+}
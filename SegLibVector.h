@@ -1,9 +1,16 @@
 #include <vector>
 #include <algorithm>
+#include <bit>
+#include <cstdint>
 #include <iostream>
 #include <concepts>
+#include <span>
+#include <stdexcept>
 
 #include "SegLibConcepts.h"
+#include "SegLibNumerical.h"
+
+#pragma once
 
 namespace SLV {
 
@@ -306,6 +313,32 @@ DELETION FUNCTIONS
 */
 
 
+    /**
+     * @brief Satisfied when a Condition of this type can be SLN::IsPrime<T>. The conditional functions check for that predicate at runtime and
+     *        hand it to SLN::IsPrimeBatch instead of calling it per element. Other types never instantiate the batch path.
+     */
+    template <typename T, typename Condition>
+    concept PrimeBatchable = std::integral<T> && !std::same_as<T, bool> && IntegralNumerical<T> && std::same_as<Condition, bool (*)(T)>;
+
+    /**
+     * @brief Copies the elements of Vector whose Mask entry, as a bool, equals Keep.
+     */
+    template <typename T>
+    std::vector<T> MaskedCopy(const std::vector<T>& Vector, const std::vector<uint8_t>& Mask, bool Keep) {
+
+        std::vector<T> ReturnVector;
+        ReturnVector.reserve(Vector.size());
+
+        for (size_t i = 0; i < Vector.size(); i++) {
+            if ((Mask[i] != 0) == Keep) {
+                ReturnVector.emplace_back(Vector[i]);
+            }
+        }
+
+        return ReturnVector;
+
+    }
+
     /**
      * @brief Creates a vector of elements that ConditionalFunc evaluates as true.
      * 
@@ -320,6 +353,12 @@ DELETION FUNCTIONS
     template <typename T, typename Condition>
     std::vector<T> ConditionalInclusion(const std::vector<T>& Vector, Condition ConditionalFunc) {
 
+        if constexpr (PrimeBatchable<T, Condition>) {
+            if (ConditionalFunc == &SLN::IsPrime<T>) {
+                return MaskedCopy(Vector, SLN::IsPrimeBatch(std::span<const T>(Vector)), true);
+            }
+        }
+
         std::vector<T> ReturnVector;
         ReturnVector.reserve(Vector.size());
 
@@ -338,6 +377,15 @@ DELETION FUNCTIONS
     template <typename T, typename Condition>
     size_t ConditionalInclusion_p(std::vector<T>& Vector, Condition ConditionalFunc) {
 
+        if constexpr (PrimeBatchable<T, Condition>) {
+            if (ConditionalFunc == &SLN::IsPrime<T>) {
+                std::vector<T> Primes = MaskedCopy(Vector, SLN::IsPrimeBatch(std::span<const T>(Vector)), true);
+                size_t ElementsRemoved = Vector.size() - Primes.size();
+                Vector = std::move(Primes);
+                return ElementsRemoved;
+            }
+        }
+
         std::vector<T> ReturnVector;
         ReturnVector.reserve(Vector.size());
 
@@ -374,6 +422,12 @@ DELETION FUNCTIONS
     template <typename T, typename Condition>
     std::vector<T> ConditionalExclusion(const std::vector<T>& Vector, Condition ConditionalFunc) {
 
+        if constexpr (PrimeBatchable<T, Condition>) {
+            if (ConditionalFunc == &SLN::IsPrime<T>) {
+                return MaskedCopy(Vector, SLN::IsPrimeBatch(std::span<const T>(Vector)), false);
+            }
+        }
+
         std::vector<T> ReturnVector;
         ReturnVector.reserve(Vector.size());
 
@@ -392,6 +446,15 @@ DELETION FUNCTIONS
     template <typename T, typename Condition>
     size_t ConditionalExclusion_p(std::vector<T>& Vector, Condition ConditionalFunc) {
 
+        if constexpr (PrimeBatchable<T, Condition>) {
+            if (ConditionalFunc == &SLN::IsPrime<T>) {
+                std::vector<T> NonPrimes = MaskedCopy(Vector, SLN::IsPrimeBatch(std::span<const T>(Vector)), false);
+                size_t ElementsRemoved = Vector.size() - NonPrimes.size();
+                Vector = std::move(NonPrimes);
+                return ElementsRemoved;
+            }
+        }
+
         std::vector<T> ReturnVector;
         ReturnVector.reserve(Vector.size());
 
@@ -704,6 +767,349 @@ TRANSFORMATIONAL FUNCTIONS
     }
 
 
+/*
+==================================================================================================================================================================================
+SELECTION FUNCTIONS
+
+    Functions centred around filtering by position, so that elements are only copied once filtering is complete
+
+==================================================================================================================================================================================
+*/
+
+    /**
+     * @brief Positions of selected elements, in ascending order.
+     *
+     * @note Positions are 32 bit to halve the memory traffic of gathers, so selections cover at most 2^32 elements. Making one over more throws
+     *       std::length_error.
+     */
+    using SelectionVector = std::vector<uint32_t>;
+
+    /**
+     * @brief Throws std::length_error if the positions [0, Count) do not all fit in a SelectionVector.
+     */
+    inline void RequireSelectable(size_t Count) {
+
+        if (Count != 0 && Count - 1 > UINT32_MAX) {
+            throw std::length_error("SLV::SelectionVector: more than 2^32 elements cannot be selected by position");
+        }
+
+    }
+
+    /**
+     * @brief One bit per element, packed 64 to a word. Bits past Size in the final word are always zero.
+     */
+    struct Bitmask {
+        std::vector<uint64_t> Words;
+        size_t Size = 0;
+    };
+
+    /**
+     * @brief Builds a selection vector of every index i in [0, Count) for which IndexPredicate(i) is true.
+     *
+     * @note Every index is written and the write cursor advanced by the predicate's result, so the loop has no data dependent branch.
+     */
+    template <typename IndexPredicate>
+    SelectionVector IndicesWhere(size_t Count, IndexPredicate Predicate) {
+
+        RequireSelectable(Count);
+
+        SelectionVector Selection(Count);
+        size_t Selected = 0;
+
+        for (size_t i = 0; i < Count; i++) {
+            Selection[Selected] = static_cast<uint32_t>(i);
+            Selected += Predicate(i) ? 1 : 0;
+        }
+
+        Selection.resize(Selected);
+        return Selection;
+
+    }
+
+    /**
+     * @brief Builds a bitmask with bit i set for every index i in [0, Count) for which IndexPredicate(i) is true.
+     */
+    template <typename IndexPredicate>
+    Bitmask MaskWhere(size_t Count, IndexPredicate Predicate) {
+
+        Bitmask Mask;
+        Mask.Size = Count;
+        Mask.Words.assign((Count + 63) / 64, 0);
+
+        for (size_t Word = 0; Word < Mask.Words.size(); Word++) {
+
+            size_t Base = Word * 64;
+            size_t BlockSize = std::min<size_t>(64, Count - Base);
+            uint64_t Bits = 0;
+
+            for (size_t j = 0; j < BlockSize; j++) {
+                Bits |= uint64_t(Predicate(Base + j) ? 1 : 0) << j;
+            }
+
+            Mask.Words[Word] = Bits;
+
+        }
+
+        return Mask;
+
+    }
+
+    /**
+     * @brief Combines two masks of equal size, bit i is set if it is set in both.
+     *
+     * @throws std::invalid_argument If the masks differ in size, as they were then not built over the same vector.
+     */
+    inline Bitmask MaskAnd(const Bitmask& Mask1, const Bitmask& Mask2) {
+
+        if (Mask1.Size != Mask2.Size) {
+            throw std::invalid_argument("SLV::MaskAnd: masks differ in size");
+        }
+
+        Bitmask Result;
+        Result.Size = Mask1.Size;
+        Result.Words.resize(Mask1.Words.size());
+
+        for (size_t i = 0; i < Result.Words.size(); i++) {
+            Result.Words[i] = Mask1.Words[i] & Mask2.Words[i];
+        }
+
+        return Result;
+
+    }
+
+    /**
+     * @brief Combines two masks of equal size, bit i is set if it is set in either.
+     *
+     * @throws std::invalid_argument If the masks differ in size, as they were then not built over the same vector.
+     */
+    inline Bitmask MaskOr(const Bitmask& Mask1, const Bitmask& Mask2) {
+
+        if (Mask1.Size != Mask2.Size) {
+            throw std::invalid_argument("SLV::MaskOr: masks differ in size");
+        }
+
+        Bitmask Result;
+        Result.Size = Mask1.Size;
+        Result.Words.resize(Mask1.Words.size());
+
+        for (size_t i = 0; i < Result.Words.size(); i++) {
+            Result.Words[i] = Mask1.Words[i] | Mask2.Words[i];
+        }
+
+        return Result;
+
+    }
+
+    /**
+     * @brief Inverts a mask, leaving the bits past Size clear.
+     */
+    inline Bitmask MaskNot(const Bitmask& Mask) {
+
+        Bitmask Result;
+        Result.Size = Mask.Size;
+        Result.Words.resize(Mask.Words.size());
+
+        for (size_t i = 0; i < Result.Words.size(); i++) {
+            Result.Words[i] = ~Mask.Words[i];
+        }
+
+        if (Mask.Size % 64 != 0) {
+            Result.Words.back() &= (uint64_t(1) << (Mask.Size % 64)) - 1;
+        }
+
+        return Result;
+
+    }
+
+    /**
+     * @brief Counts the set bits of a mask.
+     */
+    inline size_t MaskCount(const Bitmask& Mask) {
+
+        size_t Count = 0;
+
+        for (uint64_t Word : Mask.Words) {
+            Count += std::popcount(Word);
+        }
+
+        return Count;
+
+    }
+
+    inline SelectionVector MaskToSelection(const Bitmask& Mask) {
+
+        RequireSelectable(Mask.Size);
+
+        SelectionVector Selection;
+        Selection.reserve(MaskCount(Mask));
+
+        for (size_t Word = 0; Word < Mask.Words.size(); Word++) {
+
+            uint64_t Bits = Mask.Words[Word];
+
+            while (Bits) {
+                Selection.push_back(static_cast<uint32_t>(Word * 64 + std::countr_zero(Bits)));
+                Bits &= Bits - 1;
+            }
+
+        }
+
+        return Selection;
+
+    }
+
+    inline Bitmask SelectionToMask(const SelectionVector& Selection, size_t Size) {
+
+        Bitmask Mask;
+        Mask.Size = Size;
+        Mask.Words.assign((Size + 63) / 64, 0);
+
+        for (uint32_t Index : Selection) {
+            Mask.Words[Index / 64] |= uint64_t(1) << (Index % 64);
+        }
+
+        return Mask;
+
+    }
+
+    /**
+     * @brief Copies the selected elements of a vector, in order of Selection.
+     *
+     * @tparam T Vector element type.
+     * @param Vector A constant reference to the vector the selection was made from.
+     * @param Selection The positions to copy.
+     * @return A vector of the selected elements.
+     */
+    template <typename T>
+    std::vector<T> Gather(const std::vector<T>& Vector, const SelectionVector& Selection) {
+
+        std::vector<T> ReturnVector;
+        ReturnVector.reserve(Selection.size());
+
+        for (uint32_t Index : Selection) {
+            ReturnVector.emplace_back(Vector[Index]);
+        }
+
+        return ReturnVector;
+
+    }
+
+    /**
+     * @brief Copies the elements of a vector whose bit is set in Mask, preserving order.
+     */
+    template <typename T>
+    std::vector<T> Gather(const std::vector<T>& Vector, const Bitmask& Mask) {
+
+        std::vector<T> ReturnVector;
+        ReturnVector.reserve(MaskCount(Mask));
+
+        for (size_t Word = 0; Word < Mask.Words.size(); Word++) {
+
+            uint64_t Bits = Mask.Words[Word];
+
+            while (Bits) {
+                ReturnVector.emplace_back(Vector[Word * 64 + std::countr_zero(Bits)]);
+                Bits &= Bits - 1;
+            }
+
+        }
+
+        return ReturnVector;
+
+    }
+
+    template <typename T, typename Condition>
+    SelectionVector ConditionalInclusionIndices(const std::vector<T>& Vector, Condition ConditionalFunc) {
+
+        if constexpr (PrimeBatchable<T, Condition>) {
+            if (ConditionalFunc == &SLN::IsPrime<T>) {
+                std::vector<uint8_t> Primes = SLN::IsPrimeBatch(std::span<const T>(Vector));
+                return IndicesWhere(Vector.size(), [&](size_t i) { return Primes[i] != 0; });
+            }
+        }
+
+        return IndicesWhere(Vector.size(), [&](size_t i) { return static_cast<bool>(ConditionalFunc(Vector[i])); });
+    }
+
+    template <typename T, typename Condition>
+    Bitmask ConditionalInclusionMask(const std::vector<T>& Vector, Condition ConditionalFunc) {
+
+        if constexpr (PrimeBatchable<T, Condition>) {
+            if (ConditionalFunc == &SLN::IsPrime<T>) {
+                std::vector<uint8_t> Primes = SLN::IsPrimeBatch(std::span<const T>(Vector));
+                return MaskWhere(Vector.size(), [&](size_t i) { return Primes[i] != 0; });
+            }
+        }
+
+        return MaskWhere(Vector.size(), [&](size_t i) { return static_cast<bool>(ConditionalFunc(Vector[i])); });
+    }
+
+    template <typename T, typename Condition>
+    SelectionVector ConditionalExclusionIndices(const std::vector<T>& Vector, Condition ConditionalFunc) {
+
+        if constexpr (PrimeBatchable<T, Condition>) {
+            if (ConditionalFunc == &SLN::IsPrime<T>) {
+                std::vector<uint8_t> Primes = SLN::IsPrimeBatch(std::span<const T>(Vector));
+                return IndicesWhere(Vector.size(), [&](size_t i) { return Primes[i] == 0; });
+            }
+        }
+
+        return IndicesWhere(Vector.size(), [&](size_t i) { return !ConditionalFunc(Vector[i]); });
+    }
+
+    template <typename T, typename Condition>
+    Bitmask ConditionalExclusionMask(const std::vector<T>& Vector, Condition ConditionalFunc) {
+
+        if constexpr (PrimeBatchable<T, Condition>) {
+            if (ConditionalFunc == &SLN::IsPrime<T>) {
+                std::vector<uint8_t> Primes = SLN::IsPrimeBatch(std::span<const T>(Vector));
+                return MaskWhere(Vector.size(), [&](size_t i) { return Primes[i] == 0; });
+            }
+        }
+
+        return MaskWhere(Vector.size(), [&](size_t i) { return !ConditionalFunc(Vector[i]); });
+    }
+
+    template <typename T, typename Comparison>
+    SelectionVector ComparativeInclusionIndices(const std::vector<T>& Vector, const T& CompVar, Comparison ComparativeFunc) {
+        return IndicesWhere(Vector.size(), [&](size_t i) { return static_cast<bool>(ComparativeFunc(Vector[i], CompVar)); });
+    }
+
+    template <typename T, typename Comparison>
+    Bitmask ComparativeInclusionMask(const std::vector<T>& Vector, const T& CompVar, Comparison ComparativeFunc) {
+        return MaskWhere(Vector.size(), [&](size_t i) { return static_cast<bool>(ComparativeFunc(Vector[i], CompVar)); });
+    }
+
+    template <typename T, typename Comparison>
+    SelectionVector ComparativeExclusionIndices(const std::vector<T>& Vector, const T& CompVar, Comparison ComparativeFunc) {
+        return IndicesWhere(Vector.size(), [&](size_t i) { return !ComparativeFunc(Vector[i], CompVar); });
+    }
+
+    template <typename T, typename Comparison>
+    Bitmask ComparativeExclusionMask(const std::vector<T>& Vector, const T& CompVar, Comparison ComparativeFunc) {
+        return MaskWhere(Vector.size(), [&](size_t i) { return !ComparativeFunc(Vector[i], CompVar); });
+    }
+
+    template <EqualityCompatible T>
+    SelectionVector EqualityInclusionIndices(const std::vector<T>& Vector, const T& CompVar) {
+        return IndicesWhere(Vector.size(), [&](size_t i) { return Vector[i] == CompVar; });
+    }
+
+    template <EqualityCompatible T>
+    Bitmask EqualityInclusionMask(const std::vector<T>& Vector, const T& CompVar) {
+        return MaskWhere(Vector.size(), [&](size_t i) { return Vector[i] == CompVar; });
+    }
+
+    template <EqualityCompatible T>
+    SelectionVector EqualityExclusionIndices(const std::vector<T>& Vector, const T& CompVar) {
+        return IndicesWhere(Vector.size(), [&](size_t i) { return !(Vector[i] == CompVar); });
+    }
+
+    template <EqualityCompatible T>
+    Bitmask EqualityExclusionMask(const std::vector<T>& Vector, const T& CompVar) {
+        return MaskWhere(Vector.size(), [&](size_t i) { return !(Vector[i] == CompVar); });
+    }
+
 /*
 ==================================================================================================================================================================================
 IOSTREAM FUNCTIONS